@@ -0,0 +1,91 @@
+/* Proposed SG14 status_code benchmarks
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_BENCH_HPP
+#define SYSTEM_ERROR2_BENCH_HPP
+
+#include <atomic>
+#include <cstddef>
+
+/* A deliberately tiny benchmark harness so the benchmarks have no dependencies
+beyond the library itself. Each benchmark is a function taking an iteration
+count which it must loop over. The harness calibrates the iteration count,
+and reports nanoseconds per operation and heap allocations per operation.
+*/
+namespace bench
+{
+  //! The signature of a benchmark function
+  using function_type = void (*)(size_t iterations);
+
+  //! Registers a benchmark with the harness at static initialisation time
+  struct registration
+  {
+    const char *name;
+    function_type func;
+    registration *next;
+
+    registration(const char *_name, function_type _func) noexcept;
+  };
+
+  //! The head of the list of registered benchmarks
+  registration *&registrations() noexcept;
+
+  //! The count of heap allocations performed since process start
+  std::atomic<size_t> &allocation_count() noexcept;
+
+  //! Prevent the compiler from optimising away a value
+  template <class T> inline void do_not_optimise(T &&v) noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : "r,m"(v) : "memory");
+#else
+    static volatile const void *sink;
+    sink = &v;
+#endif
+  }
+
+  //! Prevent the compiler from assuming anything about memory
+  inline void clobber_memory() noexcept
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : : "memory");
+#else
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+  }
+}  // namespace bench
+
+#define SYSTEM_ERROR2_BENCH_GLUE2(a, b) a##b
+#define SYSTEM_ERROR2_BENCH_GLUE(a, b) SYSTEM_ERROR2_BENCH_GLUE2(a, b)
+
+#define SYSTEM_ERROR2_BENCH_IMPL(name, id)                                                                             \
+  static void SYSTEM_ERROR2_BENCH_GLUE(bench_, id)(size_t iterations);                                                 \
+  static ::bench::registration SYSTEM_ERROR2_BENCH_GLUE(bench_registration_, id)(                                      \
+  name, &SYSTEM_ERROR2_BENCH_GLUE(bench_, id));                                                                        \
+  static void SYSTEM_ERROR2_BENCH_GLUE(bench_, id)(size_t iterations)
+
+//! Defines a benchmark called `name`. The body receives `size_t iterations`.
+#define BENCHMARK(name) SYSTEM_ERROR2_BENCH_IMPL(name, __COUNTER__)
+
+#endif
@@ -0,0 +1,174 @@
+/* Proposed SG14 status_code benchmarks
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bench.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace bench
+{
+  registration *&registrations() noexcept
+  {
+    static registration *head;
+    return head;
+  }
+
+  registration::registration(const char *_name, function_type _func) noexcept
+      : name(_name)
+      , func(_func)
+      , next(nullptr)
+  {
+    // Append so benchmarks run in the order in which they appear in their source file
+    registration **p = &registrations();
+    while(*p != nullptr)
+    {
+      p = &(*p)->next;
+    }
+    *p = this;
+  }
+
+  std::atomic<size_t> &allocation_count() noexcept
+  {
+    static std::atomic<size_t> v;
+    return v;
+  }
+}  // namespace bench
+
+/* Count heap allocations. On glibc we interpose malloc() itself, as much of
+the library (e.g. `atomic_refcounted_string_ref`) calls malloc() directly.
+Elsewhere we can only see allocations made via operator new.
+*/
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__)
+extern "C"
+{
+  extern void *__libc_malloc(size_t size);
+  extern void *__libc_calloc(size_t nmemb, size_t size);
+  extern void *__libc_realloc(void *ptr, size_t size);
+  extern void __libc_free(void *ptr);
+
+  void *malloc(size_t size)
+  {
+    bench::allocation_count().fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+  }
+  void *calloc(size_t nmemb, size_t size)
+  {
+    bench::allocation_count().fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(nmemb, size);
+  }
+  void *realloc(void *ptr, size_t size)
+  {
+    bench::allocation_count().fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(ptr, size);
+  }
+  void free(void *ptr) { __libc_free(ptr); }
+}
+#else
+void *operator new(size_t size)
+{
+  bench::allocation_count().fetch_add(1, std::memory_order_relaxed);
+  void *ret = malloc(size != 0 ? size : 1);
+  if(ret == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return ret;
+}
+void operator delete(void *p) noexcept
+{
+  free(p);
+}
+void operator delete(void *p, size_t /*unused*/) noexcept
+{
+  free(p);
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+  const char *filter = nullptr;
+  double min_seconds = 0.25;
+  for(int n = 1; n < argc; n++)
+  {
+    if(0 == strncmp(argv[n], "--min-time=", 11))
+    {
+      min_seconds = atof(argv[n] + 11);
+    }
+    else if(0 == strcmp(argv[n], "--help"))
+    {
+      printf("Usage: %s [--min-time=seconds] [substring of benchmark names to run]\n", argv[0]);
+      return 0;
+    }
+    else
+    {
+      filter = argv[n];
+    }
+  }
+#ifndef NDEBUG
+  printf("WARNING: benchmarks were built without NDEBUG defined, results will not be representative!\n\n");
+#endif
+  printf("%-80s %14s %14s\n", "Benchmark", "ns/op", "allocs/op");
+  for(bench::registration *r = bench::registrations(); r != nullptr; r = r->next)
+  {
+    if(filter != nullptr && strstr(r->name, filter) == nullptr)
+    {
+      continue;
+    }
+    // Warm caches and any lazily initialised state
+    r->func(16);
+    size_t iterations = 16;
+    for(;;)
+    {
+      const size_t allocs_before = bench::allocation_count().load(std::memory_order_relaxed);
+      const auto begin = std::chrono::steady_clock::now();
+      r->func(iterations);
+      const auto end = std::chrono::steady_clock::now();
+      const size_t allocs = bench::allocation_count().load(std::memory_order_relaxed) - allocs_before;
+      const double secs = std::chrono::duration<double>(end - begin).count();
+      if(secs >= min_seconds || iterations >= (size_t(1) << 40))
+      {
+        printf("%-80s %14.2f %14.3f\n", r->name, secs * 1000000000.0 / (double) iterations,
+               (double) allocs / (double) iterations);
+        fflush(stdout);
+        break;
+      }
+      // Aim a little beyond the minimum time, but never grow by more than 100x per round
+      size_t next = iterations * 100;
+      if(secs > 0)
+      {
+        const double scaled = (double) iterations * min_seconds * 1.2 / secs;
+        if(scaled < (double) next)
+        {
+          next = (size_t) scaled + 1;
+        }
+      }
+      iterations = (next > iterations) ? next : iterations * 2;
+    }
+  }
+  return 0;
+}
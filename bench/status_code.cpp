@@ -0,0 +1,1130 @@
+/* Proposed SG14 status_code benchmarks
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "bench.hpp"
+
+#include "status-code/atomic_status_code.hpp"
+#include "status-code/flight_recorder.hpp"
+#include "status-code/http_status_code.hpp"
+#include "status-code/http_status_line.hpp"
+#include "status-code/message_arena.hpp"
+#include "status-code/nested_status_code.hpp"
+#include "status-code/packed_status_code.hpp"
+#include "status-code/remote_nt_code.hpp"
+#include "status-code/status_code_map.hpp"
+#include "status-code/std_error_code.hpp"
+#include "status-code/system_error2.hpp"
+#include "status-code/telemetry.hpp"
+#include "status-code/wire_format.hpp"
+
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS)
+#include "status-code/system_code_from_exception.hpp"
+#endif
+#ifdef BENCH_FMT_SUPPORT
+#include "status-code/fmt_support.hpp"
+#endif
+#include "status-code/iostream_support.hpp"
+
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+// A quick status code from enum domain of the kind an RPC layer might define
+enum class bench_code : int
+{
+  success,
+  bad_request,
+  unauthorised,
+  forbidden,
+  not_found,
+  timeout,
+  conflict,
+  too_large,
+  unavailable,
+  internal
+};
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+template <> struct quick_status_code_from_enum<bench_code> : quick_status_code_from_enum_defaults<bench_code>
+{
+  static constexpr const auto domain_name = "bench code";
+  static constexpr const auto domain_uuid = "{4a7e2c0b-93d1-4f4e-8a2b-6a1b2c3d4e5f}";
+  static const std::initializer_list<mapping> &value_mappings()
+  {
+    static const std::initializer_list<mapping> v = {
+    {bench_code::success, "success", {errc::success}},                                          //
+    {bench_code::bad_request, "bad request", {errc::invalid_argument}},                         //
+    {bench_code::unauthorised, "unauthorised", {errc::operation_not_permitted}},                //
+    {bench_code::forbidden, "forbidden", {errc::permission_denied}},                            //
+    {bench_code::not_found, "not found", {errc::no_such_file_or_directory}},                    //
+    {bench_code::timeout, "timeout", {errc::timed_out}},                                        //
+    {bench_code::conflict, "conflict", {errc::file_exists}},                                    //
+    {bench_code::too_large, "too large", {errc::value_too_large}},                              //
+    {bench_code::unavailable, "unavailable", {errc::resource_unavailable_try_again}},           //
+    {bench_code::internal, "internal", {errc::state_not_recoverable, errc::io_error}},          //
+    };
+    return v;
+  }
+};
+SYSTEM_ERROR2_NAMESPACE_END
+
+using namespace SYSTEM_ERROR2_NAMESPACE;
+
+namespace
+{
+  // Values are read through volatiles to prevent constant folding
+  volatile int errno_value = ENOENT;
+  // Beyond any message cache, so messages must be rendered and allocated
+  volatile int uncached_errno_value = 4000;
+  // Has a message too long to be kept inline within a string_ref
+  volatile int long_message_errno_value = ENOTTY;
+  volatile int http_value = 503;
+  volatile int32_t remote_nt_value = static_cast<int32_t>(0xC0000034);  // STATUS_OBJECT_NAME_NOT_FOUND
+  volatile int enum_value = static_cast<int>(bench_code::internal);
+
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+  using native_code = posix_code;
+#else
+  using native_code = generic_code;
+#endif
+  inline native_code make_native() { return native_code(static_cast<native_code::value_type>(errno_value)); }
+  inline native_code make_uncached_native()
+  {
+    return native_code(static_cast<native_code::value_type>(uncached_errno_value));
+  }
+  inline system_code make_std_error_code() { return system_code(std::error_code(errno_value, std::generic_category())); }
+  inline generic_code make_generic() { return generic_code(static_cast<errc>(errno_value)); }
+  inline http_status_code make_http() { return http_status_code(static_cast<int>(http_value)); }
+  inline remote_nt_code make_remote_nt() { return remote_nt_code(static_cast<int32_t>(remote_nt_value)); }
+  inline quick_status_code_from_enum_code<bench_code> make_enum()
+  {
+    return quick_status_code_from_enum_code<bench_code>(static_cast<bench_code>(enum_value));
+  }
+  inline system_code make_nested() { return make_nested_status_code(make_native()); }
+  inline system_code make_pooled_nested()
+  {
+    return make_nested_status_code(make_native(), thread_caching_pool_allocator<native_code>());
+  }
+  inline system_code make_shared_nested() { return make_shared_nested_status_code(make_native()); }
+  inline system_code make_pooled_shared_nested()
+  {
+    return make_shared_nested_status_code(make_native(), thread_caching_pool_allocator<native_code>());
+  }
+}  // namespace
+
+/***** Construction of typed codes *****/
+BENCHMARK("construct generic_code")
+{
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(make_generic());
+  }
+}
+BENCHMARK("construct posix_code")
+{
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(make_native());
+  }
+}
+BENCHMARK("construct http_status_code")
+{
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(make_http());
+  }
+}
+BENCHMARK("construct quick_status_code_from_enum")
+{
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(make_enum());
+  }
+}
+
+/***** Erasure into system_code *****/
+BENCHMARK("erase generic_code into system_code")
+{
+  for(size_t n = 0; n < iterations; n++)
+  {
+    system_code sc(make_generic());
+    bench::do_not_optimise(sc);
+  }
+}
+BENCHMARK("erase posix_code into system_code")
+{
+  for(size_t n = 0; n < iterations; n++)
+  {
+    system_code sc(make_native());
+    bench::do_not_optimise(sc);
+  }
+}
+BENCHMARK("erase http_status_code into system_code")
+{
+  for(size_t n = 0; n < iterations; n++)
+  {
+    system_code sc(make_http());
+    bench::do_not_optimise(sc);
+  }
+}
+BENCHMARK("erase quick_status_code_from_enum into system_code")
+{
+  for(size_t n = 0; n < iterations; n++)
+  {
+    system_code sc(make_enum());
+    bench::do_not_optimise(sc);
+  }
+}
+BENCHMARK("erase make_nested_status_code into system_code")
+{
+  for(size_t n = 0; n < iterations; n++)
+  {
+    system_code sc(make_nested());
+    bench::do_not_optimise(sc);
+  }
+}
+BENCHMARK("erase make_nested_status_code(pooled) into system_code")
+{
+  for(size_t n = 0; n < iterations; n++)
+  {
+    system_code sc(make_pooled_nested());
+    bench::do_not_optimise(sc);
+  }
+}
+BENCHMARK("erase make_shared_nested_status_code into system_code")
+{
+  for(size_t n = 0; n < iterations; n++)
+  {
+    system_code sc(make_shared_nested());
+    bench::do_not_optimise(sc);
+  }
+}
+BENCHMARK("erase make_shared_nested_status_code(pooled) into system_code")
+{
+  for(size_t n = 0; n < iterations; n++)
+  {
+    system_code sc(make_pooled_shared_nested());
+    bench::do_not_optimise(sc);
+  }
+}
+
+BENCHMARK("erase std::error_code into system_code")
+{
+  const std::error_code ec(errno_value, std::generic_category());
+  for(size_t n = 0; n < iterations; n++)
+  {
+    system_code sc(ec);
+    bench::do_not_optimise(sc);
+  }
+}
+
+// The cost added to erasing a failure when SYSTEM_ERROR2_ENABLE_TELEMETRY is true
+BENCHMARK("telemetry count of a failure")
+{
+  const system_code sc(make_native());
+  for(size_t n = 0; n < iterations; n++)
+  {
+    detail::telemetry_record(sc.domain().id(), sc.value());
+  }
+  bench::do_not_optimise(status_code_telemetry_take_snapshot().entries.size());
+}
+
+BENCHMARK("flight_recorder::record() system_code(posix_code)")
+{
+  const system_code sc(make_native());
+  flight_recorder::thread_init();
+  for(size_t n = 0; n < iterations; n++)
+  {
+    SYSTEM_ERROR2_FLIGHT_RECORD(sc);
+  }
+}
+
+/***** atomic_status_code *****/
+BENCHMARK("atomic_status_code cancelled() poll")
+{
+  atomic_status_code first;
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(first.cancelled());
+  }
+}
+BENCHMARK("atomic_status_code try_set_first() and reset()")
+{
+  atomic_status_code first;
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(first.try_set_first(make_native()));
+    bench::do_not_optimise(first.reset());
+  }
+}
+BENCHMARK("atomic_status_code losing try_set_first()")
+{
+  atomic_status_code first(make_native());
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(first.try_set_first(make_native()));
+  }
+}
+BENCHMARK("atomic_status_code load()")
+{
+  atomic_status_code first(make_native());
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(first.load());
+  }
+}
+// What atomic_status_code replaces
+BENCHMARK("mutex guarded system_code set first and reset")
+{
+  std::mutex lock;
+  system_code first;
+  for(size_t n = 0; n < iterations; n++)
+  {
+    {
+      std::lock_guard<std::mutex> g(lock);
+      if(first.empty())
+      {
+        first = make_native();
+      }
+    }
+    std::lock_guard<std::mutex> g(lock);
+    system_code taken(std::move(first));
+    bench::do_not_optimise(taken);
+  }
+}
+BENCHMARK("mutex guarded system_code load()")
+{
+  std::mutex lock;
+  system_code first(make_native());
+  for(size_t n = 0; n < iterations; n++)
+  {
+    std::lock_guard<std::mutex> g(lock);
+    bench::do_not_optimise(first.clone());
+  }
+}
+
+/***** clone() *****/
+BENCHMARK("clone system_code(posix_code)")
+{
+  const system_code sc(make_native());
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(sc.clone());
+  }
+}
+BENCHMARK("clone system_code(nested)")
+{
+  const system_code sc(make_nested());
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(sc.clone());
+  }
+}
+BENCHMARK("clone system_code(nested, pooled)")
+{
+  const system_code sc(make_pooled_nested());
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(sc.clone());
+  }
+}
+BENCHMARK("clone system_code(shared nested)")
+{
+  const system_code sc(make_shared_nested());
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(sc.clone());
+  }
+}
+
+/***** success()/failure() on erased codes *****/
+#define SYSTEM_ERROR2_BENCH_FAILURE(name, maker)                                                                        \
+  BENCHMARK("failure() system_code(" name ")")                                                                         \
+  {                                                                                                                    \
+    const system_code sc(maker());                                                                                     \
+    const status_code<void> &erased = sc;                                                                              \
+    size_t count = 0;                                                                                                  \
+    for(size_t n = 0; n < iterations; n++)                                                                             \
+    {                                                                                                                  \
+      bench::clobber_memory();                                                                                         \
+      count += erased.failure();                                                                                       \
+    }                                                                                                                  \
+    bench::do_not_optimise(count);                                                                                     \
+  }                                                                                                                    \
+  BENCHMARK("success() system_code(" name ")")                                                                         \
+  {                                                                                                                    \
+    const system_code sc(maker());                                                                                     \
+    const status_code<void> &erased = sc;                                                                              \
+    size_t count = 0;                                                                                                  \
+    for(size_t n = 0; n < iterations; n++)                                                                             \
+    {                                                                                                                  \
+      bench::clobber_memory();                                                                                         \
+      count += erased.success();                                                                                       \
+    }                                                                                                                  \
+    bench::do_not_optimise(count);                                                                                     \
+  }
+SYSTEM_ERROR2_BENCH_FAILURE("generic_code", make_generic)
+SYSTEM_ERROR2_BENCH_FAILURE("posix_code", make_native)
+SYSTEM_ERROR2_BENCH_FAILURE("http_status_code", make_http)
+SYSTEM_ERROR2_BENCH_FAILURE("quick_status_code_from_enum", make_enum)
+SYSTEM_ERROR2_BENCH_FAILURE("nested", make_nested)
+#undef SYSTEM_ERROR2_BENCH_FAILURE
+
+// Codes from several domains in unpredictable order, as a server handling many kinds of request would see
+BENCHMARK("failure() system_code(mixed domains)")
+{
+  static const struct mixed_t
+  {
+    system_code codes[1024];
+    mixed_t()
+    {
+      unsigned seed = 1;
+      for(auto &i : codes)
+      {
+        seed = seed * 1103515245U + 12345U;
+        switch((seed >> 16U) % 3)
+        {
+        case 0:
+          i = generic_code((seed & 1) ? errc::success : errc::invalid_argument);
+          break;
+        case 1:
+          i = native_code((seed & 1) ? 0 : EACCES);
+          break;
+        default:
+          i = http_status_code((seed & 1) ? 200 : 503);
+          break;
+        }
+      }
+    }
+  } mixed;
+  size_t count = 0;
+  for(size_t n = 0; n < iterations; n++)
+  {
+    const status_code<void> &erased = mixed.codes[n & 1023];
+    count += erased.failure();
+  }
+  bench::do_not_optimise(count);
+}
+
+/***** domain registry *****/
+BENCHMARK("status_code_domain_from_id()")
+{
+  const status_code_domain::unique_id_type ids[] = {generic_code_domain.id(), native_code::domain_type::get().id(),
+                                                    http_status_code_domain.id(), make_enum().domain().id()};
+  register_status_code_domain(generic_code_domain);
+  register_status_code_domain(native_code::domain_type::get());
+  register_status_code_domain(http_status_code_domain);
+  register_status_code_domain(make_enum().domain());
+  size_t count = 0;
+  for(size_t n = 0; n < iterations; n++)
+  {
+    count += (status_code_domain_from_id(ids[n & 3]) != nullptr);
+  }
+  bench::do_not_optimise(count);
+}
+
+/***** packed_status_code *****/
+BENCHMARK("pack system_code(posix_code) into packed_status_code")
+{
+  const system_code sc(make_native());
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(packed_status_code(sc));
+  }
+}
+BENCHMARK("unpack packed_status_code(posix_code) into system_code")
+{
+  const packed_status_code packed(make_native());
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(packed.unpack());
+  }
+}
+// A completion table far larger than the CPU caches, scanned for failures
+template <class T> static const std::vector<T> &completion_table()
+{
+  static const std::vector<T> table = [] {
+    std::vector<T> ret(1 << 20);
+    unsigned seed = 1;
+    for(auto &i : ret)
+    {
+      seed = seed * 1103515245U + 12345U;
+      i = T(native_code((seed & 0x10000) ? 0 : EACCES));
+    }
+    return ret;
+  }();
+  return table;
+}
+BENCHMARK("failure() scan of 1M system_code")
+{
+  const auto &table = completion_table<system_code>();
+  size_t count = 0;
+  for(size_t n = 0; n < iterations; n++)
+  {
+    count += table[n & (table.size() - 1)].failure();
+  }
+  bench::do_not_optimise(count);
+}
+BENCHMARK("failure() scan of 1M packed_status_code")
+{
+  const auto &table = completion_table<packed_status_code>();
+  size_t count = 0;
+  for(size_t n = 0; n < iterations; n++)
+  {
+    count += table[n & (table.size() - 1)].failure();
+  }
+  bench::do_not_optimise(count);
+}
+
+/***** status_code_map *****/
+// The failures of a service, of sixteen distinct codes across two domains
+static const std::vector<system_code> &histogram_codes()
+{
+  static const std::vector<system_code> codes = [] {
+    std::vector<system_code> ret;
+    for(int n = 1; n <= 8; n++)
+    {
+      ret.push_back(native_code(static_cast<native_code::value_type>(n)));
+      ret.push_back(http_status_code(500 + n));
+    }
+    return ret;
+  }();
+  return codes;
+}
+using exact_unordered_map = std::unordered_map<system_code, size_t, exact_hash, exact_equal>;
+static size_t &histogram_entry(status_code_map<size_t> &map, const system_code &code)
+{
+  return map[code];
+}
+static size_t &histogram_entry(exact_unordered_map &map, const system_code &code)
+{
+  // system_code is not copyable, so it is cloned only when first inserted
+  auto it = map.find(code);
+  if(it == map.end())
+  {
+    it = map.emplace(code.clone(), 0).first;
+  }
+  return it->second;
+}
+template <class Map> static void histogram_count(Map &map, size_t iterations)
+{
+  const auto &codes = histogram_codes();
+  for(size_t n = 0; n < iterations; n++)
+  {
+    histogram_entry(map, codes[n & 15])++;
+  }
+  bench::do_not_optimise(map.size());
+}
+template <class Map> static void histogram_find(Map &map, size_t iterations)
+{
+  const auto &codes = histogram_codes();
+  for(const auto &code : codes)
+  {
+    histogram_entry(map, code) = 1;
+  }
+  size_t count = 0;
+  for(size_t n = 0; n < iterations; n++)
+  {
+    count += map.find(codes[(n * 7) & 15])->second;
+  }
+  bench::do_not_optimise(count);
+}
+BENCHMARK("histogram of 16 codes by status_code_map")
+{
+  status_code_map<size_t> map;
+  histogram_count(map, iterations);
+}
+BENCHMARK("histogram of 16 codes by std::unordered_map<exact_hash, exact_equal>")
+{
+  exact_unordered_map map;
+  histogram_count(map, iterations);
+}
+BENCHMARK("find() in 16 codes by status_code_map")
+{
+  status_code_map<size_t> map;
+  histogram_find(map, iterations);
+}
+BENCHMARK("find() in 16 codes by std::unordered_map<exact_hash, exact_equal>")
+{
+  exact_unordered_map map;
+  histogram_find(map, iterations);
+}
+
+/***** wire format *****/
+BENCHMARK("serialise_status_code() system_code(posix_code)")
+{
+  const system_code sc(make_native());
+  alignas(8) char buffer[sizeof(status_code_wire_header)];
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(serialise_status_code(buffer, sizeof(buffer), sc));
+  }
+}
+BENCHMARK("serialise_status_code() system_code(posix_code) with message")
+{
+  const system_code sc(make_native());
+  alignas(8) char buffer[256];
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(serialise_status_code(buffer, sizeof(buffer), sc, true));
+  }
+}
+BENCHMARK("deserialise_status_code() system_code(posix_code)")
+{
+  alignas(8) char buffer[sizeof(status_code_wire_header)];
+  const size_t bytes = serialise_status_code(buffer, sizeof(buffer), system_code(make_native()));
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(deserialise_status_code(buffer, bytes));
+  }
+}
+
+/***** equivalent() against errc constants, as a request router would *****/
+#define SYSTEM_ERROR2_BENCH_EQUIVALENT(name, maker)                                                                     \
+  BENCHMARK("equivalent() system_code(" name ") vs errc match")                                                        \
+  {                                                                                                                    \
+    const system_code sc(maker());                                                                                     \
+    const generic_code target(errc::no_such_file_or_directory);                                                        \
+    size_t count = 0;                                                                                                  \
+    for(size_t n = 0; n < iterations; n++)                                                                             \
+    {                                                                                                                  \
+      bench::clobber_memory();                                                                                         \
+      count += (sc == target);                                                                                         \
+    }                                                                                                                  \
+    bench::do_not_optimise(count);                                                                                     \
+  }                                                                                                                    \
+  BENCHMARK("equivalent() system_code(" name ") vs errc mismatch")                                                     \
+  {                                                                                                                    \
+    const system_code sc(maker());                                                                                     \
+    const generic_code target(errc::operation_canceled);                                                               \
+    size_t count = 0;                                                                                                  \
+    for(size_t n = 0; n < iterations; n++)                                                                             \
+    {                                                                                                                  \
+      bench::clobber_memory();                                                                                         \
+      count += (sc == target);                                                                                         \
+    }                                                                                                                  \
+    bench::do_not_optimise(count);                                                                                     \
+  }                                                                                                                    \
+  BENCHMARK("cached_equivalent() system_code(" name ") vs errc match")                                                 \
+  {                                                                                                                    \
+    const system_code sc(maker());                                                                                     \
+    const generic_code target(errc::no_such_file_or_directory);                                                        \
+    size_t count = 0;                                                                                                  \
+    for(size_t n = 0; n < iterations; n++)                                                                             \
+    {                                                                                                                  \
+      bench::clobber_memory();                                                                                         \
+      count += sc.cached_equivalent(target);                                                                           \
+    }                                                                                                                  \
+    bench::do_not_optimise(count);                                                                                     \
+  }                                                                                                                    \
+  BENCHMARK("cached_equivalent() system_code(" name ") vs errc mismatch")                                              \
+  {                                                                                                                    \
+    const system_code sc(maker());                                                                                     \
+    const generic_code target(errc::operation_canceled);                                                               \
+    size_t count = 0;                                                                                                  \
+    for(size_t n = 0; n < iterations; n++)                                                                             \
+    {                                                                                                                  \
+      bench::clobber_memory();                                                                                         \
+      count += sc.cached_equivalent(target);                                                                           \
+    }                                                                                                                  \
+    bench::do_not_optimise(count);                                                                                     \
+  }
+SYSTEM_ERROR2_BENCH_EQUIVALENT("generic_code", make_generic)
+SYSTEM_ERROR2_BENCH_EQUIVALENT("posix_code", make_native)
+SYSTEM_ERROR2_BENCH_EQUIVALENT("http_status_code", make_http)
+SYSTEM_ERROR2_BENCH_EQUIVALENT("quick_status_code_from_enum", make_enum)
+SYSTEM_ERROR2_BENCH_EQUIVALENT("nested", make_nested)
+SYSTEM_ERROR2_BENCH_EQUIVALENT("std_error_code", make_std_error_code)
+SYSTEM_ERROR2_BENCH_EQUIVALENT("remote_nt_code", make_remote_nt)
+#undef SYSTEM_ERROR2_BENCH_EQUIVALENT
+// The same comparisons between typed codes, which traits::static_equivalence resolves without virtual calls
+#define SYSTEM_ERROR2_BENCH_STATIC_EQUIVALENT(name, maker)                                                              \
+  BENCHMARK("operator==() " name " vs errc match")                                                                      \
+  {                                                                                                                     \
+    const auto code = maker();                                                                                          \
+    const generic_code target(errc::no_such_file_or_directory);                                                         \
+    bench::do_not_optimise(&code);                                                                                      \
+    size_t count = 0;                                                                                                   \
+    for(size_t n = 0; n < iterations; n++)                                                                              \
+    {                                                                                                                   \
+      bench::clobber_memory();                                                                                          \
+      count += (code == target);                                                                                        \
+    }                                                                                                                   \
+    bench::do_not_optimise(count);                                                                                      \
+  }                                                                                                                     \
+  BENCHMARK("operator==() " name " vs errc mismatch")                                                                   \
+  {                                                                                                                     \
+    const auto code = maker();                                                                                          \
+    const generic_code target(errc::operation_canceled);                                                                \
+    bench::do_not_optimise(&code);                                                                                      \
+    size_t count = 0;                                                                                                   \
+    for(size_t n = 0; n < iterations; n++)                                                                              \
+    {                                                                                                                   \
+      bench::clobber_memory();                                                                                          \
+      count += (code == target);                                                                                        \
+    }                                                                                                                   \
+    bench::do_not_optimise(count);                                                                                      \
+  }
+SYSTEM_ERROR2_BENCH_STATIC_EQUIVALENT("posix_code", make_native)
+SYSTEM_ERROR2_BENCH_STATIC_EQUIVALENT("http_status_code", make_http)
+SYSTEM_ERROR2_BENCH_STATIC_EQUIVALENT("remote_nt_code", make_remote_nt)
+#undef SYSTEM_ERROR2_BENCH_STATIC_EQUIVALENT
+
+/***** Mapping codes from Windows by branch free binary search versus by switch *****/
+namespace
+{
+  // The form which the NT code mapping tables took before they became sorted arrays
+  uint32_t nt_code_to_win32_code_by_switch(uint32_t c)
+  {
+    switch(c)
+    {
+#define SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(from, to)                                                                    \
+  case from:                                                                                                           \
+    return to;
+#include "status-code/detail/nt_code_to_win32_code.ipp"
+#undef SYSTEM_ERROR2_WINDOWS_CODE_MAPPING
+    }
+    return static_cast<uint32_t>(-1);
+  }
+  int nt_code_to_errno_by_switch(uint32_t c)
+  {
+    switch(c)
+    {
+#define SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(from, to)                                                                    \
+  case from:                                                                                                           \
+    return to;
+#include "status-code/detail/nt_code_to_generic_code.ipp"
+#undef SYSTEM_ERROR2_WINDOWS_CODE_MAPPING
+    }
+    return -1;
+  }
+  uint32_t nt_code_to_win32_code_by_binary_search(uint32_t c)
+  {
+    return detail::windows_code_map(detail::nt_code_to_win32_code_table, c, static_cast<uint32_t>(-1));
+  }
+  int nt_code_to_errno_by_binary_search(uint32_t c)
+  {
+    return static_cast<int>(
+    detail::windows_code_map(detail::nt_code_to_generic_code_table, c, static_cast<uint32_t>(-1)));
+  }
+#if __cplusplus >= 201400 || _MSC_VER >= 1910 /* VS2017 */
+  uint32_t nt_code_to_win32_code_by_hash_index(uint32_t c)
+  {
+    return detail::windows_code_map(detail::nt_code_to_win32_code_index, c, static_cast<uint32_t>(-1));
+  }
+  int nt_code_to_errno_by_hash_index(uint32_t c)
+  {
+    return static_cast<int>(
+    detail::windows_code_map(detail::nt_code_to_generic_code_index, c, static_cast<uint32_t>(-1)));
+  }
+#endif
+  // NT codes in a pseudo random order so branches cannot be predicted, one in eight having no mapping
+  const std::vector<uint32_t> &nt_code_samples()
+  {
+    static const std::vector<uint32_t> samples = [] {
+      const auto &table = detail::nt_code_to_win32_code_table;
+      std::vector<uint32_t> ret(4096);
+      uint32_t x = 1;
+      for(auto &i : ret)
+      {
+        x = x * 1664525U + 1013904223U;
+        const uint32_t from = table[(x >> 8U) % (sizeof(table) / sizeof(table[0]))].from;
+        i = ((x >> 28U) == 0) ? (from | 0x0fff0000U) : from;
+      }
+      return ret;
+    }();
+    return samples;
+  }
+}  // namespace
+#define SYSTEM_ERROR2_BENCH_WINDOWS_CODE_MAPPING(name, func)                                                            \
+  BENCHMARK("map NT code to " name)                                                                                    \
+  {                                                                                                                    \
+    const auto &samples = nt_code_samples();                                                                           \
+    uint32_t sum = 0;                                                                                                  \
+    for(size_t n = 0; n < iterations; n++)                                                                             \
+    {                                                                                                                  \
+      sum += static_cast<uint32_t>(func(samples[n & (samples.size() - 1)]));                                           \
+    }                                                                                                                  \
+    bench::do_not_optimise(sum);                                                                                       \
+  }
+SYSTEM_ERROR2_BENCH_WINDOWS_CODE_MAPPING("Win32 code by switch", nt_code_to_win32_code_by_switch)
+SYSTEM_ERROR2_BENCH_WINDOWS_CODE_MAPPING("Win32 code by branch free binary search",
+                                         nt_code_to_win32_code_by_binary_search)
+SYSTEM_ERROR2_BENCH_WINDOWS_CODE_MAPPING("errno by switch", nt_code_to_errno_by_switch)
+SYSTEM_ERROR2_BENCH_WINDOWS_CODE_MAPPING("errno by branch free binary search", nt_code_to_errno_by_binary_search)
+#if __cplusplus >= 201400 || _MSC_VER >= 1910 /* VS2017 */
+SYSTEM_ERROR2_BENCH_WINDOWS_CODE_MAPPING("Win32 code by hash index", nt_code_to_win32_code_by_hash_index)
+SYSTEM_ERROR2_BENCH_WINDOWS_CODE_MAPPING("errno by hash index", nt_code_to_errno_by_hash_index)
+#endif
+#undef SYSTEM_ERROR2_BENCH_WINDOWS_CODE_MAPPING
+
+/***** Parsing HTTP status lines *****/
+namespace
+{
+  // Status lines as an upstream might return them, back to back in one buffer, one in sixty four being malformed
+  struct http_status_line_sample_set
+  {
+    std::string buffer;
+    std::vector<const char *> lines;
+    std::vector<size_t> lengths;
+  };
+  const http_status_line_sample_set &http_status_line_samples()
+  {
+    static const http_status_line_sample_set samples = [] {
+      static const char *const kinds[] = {"HTTP/1.1 200 OK\r\n",
+                                          "HTTP/1.1 200 OK\r\n",
+                                          "HTTP/1.1 200 OK\r\n",
+                                          "HTTP/1.1 204 No Content\r\n",
+                                          "HTTP/1.1 304 Not Modified\r\n",
+                                          "HTTP/1.0 404 Not Found\r\n",
+                                          "HTTP/1.1 502 Bad Gateway\r\n",
+                                          "HTTP/1.1 503 Service Unavailable\r\n"};
+      http_status_line_sample_set ret;
+      std::vector<size_t> offsets;
+      uint32_t x = 1;
+      for(size_t n = 0; n < 1024; n++)
+      {
+        x = x * 1664525U + 1013904223U;
+        const char *line = ((x >> 26U) == 0) ? "HTTP/1.1 5xx Broken\r\n" : kinds[(x >> 8U) & 7U];
+        offsets.push_back(ret.buffer.size());
+        ret.lengths.push_back(strlen(line));
+        ret.buffer.append(line);
+      }
+      for(auto offset : offsets)
+      {
+        ret.lines.push_back(ret.buffer.data() + offset);
+      }
+      return ret;
+    }();
+    return samples;
+  }
+  int parse_http_status_line_public(const char *line, size_t length)
+  {
+    return parse_http_status_line(line, length).value();
+  }
+}  // namespace
+#define SYSTEM_ERROR2_BENCH_HTTP_STATUS_LINE(name, func)                                                                \
+  BENCHMARK("parse HTTP status line " name)                                                                            \
+  {                                                                                                                    \
+    const auto &samples = http_status_line_samples();                                                                  \
+    int sum = 0;                                                                                                       \
+    for(size_t n = 0; n < iterations; n++)                                                                             \
+    {                                                                                                                  \
+      const size_t idx = n & (samples.lines.size() - 1);                                                               \
+      sum += func(samples.lines[idx], samples.lengths[idx]);                                                           \
+    }                                                                                                                  \
+    bench::do_not_optimise(sum);                                                                                       \
+  }
+SYSTEM_ERROR2_BENCH_HTTP_STATUS_LINE("a byte at a time", detail::parse_http_status_line_scalar)
+#if SYSTEM_ERROR2_HTTP_STATUS_LINE_SIMD >= 1
+SYSTEM_ERROR2_BENCH_HTTP_STATUS_LINE("by SSE2", detail::parse_http_status_line_sse2)
+#endif
+SYSTEM_ERROR2_BENCH_HTTP_STATUS_LINE("into http_status_code", parse_http_status_line_public)
+#undef SYSTEM_ERROR2_BENCH_HTTP_STATUS_LINE
+// Per line, in batches of 64 lines which each fill one word of the server error bitmap
+BENCHMARK("parse_http_status_line() with server error bitmap")
+{
+  const auto &samples = http_status_line_samples();
+  http_status_code codes[64];
+  uint64_t server_errors = 0;
+  size_t sum = 0;
+  for(size_t n = 0; n < iterations; n += 64)
+  {
+    const size_t idx = n & (samples.lines.size() - 1);
+    server_errors = 0;
+    for(size_t i = 0; i < 64; i++)
+    {
+      codes[i] = parse_http_status_line(samples.lines[idx + i], samples.lengths[idx + i]);
+      sum += !codes[i].empty();
+      server_errors |= static_cast<uint64_t>(codes[i].is_http_server_error()) << i;
+    }
+    sum += static_cast<size_t>(server_errors);
+    bench::do_not_optimise(codes);
+  }
+  bench::do_not_optimise(sum);
+}
+BENCHMARK("parse_http_status_lines() with server error bitmap")
+{
+  const auto &samples = http_status_line_samples();
+  http_status_code codes[64];
+  uint64_t server_errors = 0;
+  size_t sum = 0;
+  for(size_t n = 0; n < iterations; n += 64)
+  {
+    const size_t idx = n & (samples.lines.size() - 1);
+    sum += parse_http_status_lines(codes, &server_errors, &samples.lines[idx], &samples.lengths[idx], 64);
+    sum += static_cast<size_t>(server_errors);
+    bench::do_not_optimise(codes);
+  }
+  bench::do_not_optimise(sum);
+}
+
+/***** message() *****/
+#define SYSTEM_ERROR2_BENCH_MESSAGE(name, maker)                                                                        \
+  BENCHMARK("message() system_code(" name ")")                                                                         \
+  {                                                                                                                    \
+    const system_code sc(maker());                                                                                     \
+    for(size_t n = 0; n < iterations; n++)                                                                             \
+    {                                                                                                                  \
+      auto msg = sc.message();                                                                                         \
+      bench::do_not_optimise(msg.data());                                                                              \
+    }                                                                                                                  \
+  }
+SYSTEM_ERROR2_BENCH_MESSAGE("generic_code", make_generic)
+SYSTEM_ERROR2_BENCH_MESSAGE("posix_code", make_native)
+SYSTEM_ERROR2_BENCH_MESSAGE("http_status_code", make_http)
+SYSTEM_ERROR2_BENCH_MESSAGE("quick_status_code_from_enum", make_enum)
+SYSTEM_ERROR2_BENCH_MESSAGE("nested", make_nested)
+SYSTEM_ERROR2_BENCH_MESSAGE("posix_code, uncached message", make_uncached_native)
+SYSTEM_ERROR2_BENCH_MESSAGE("std::error_code", make_std_error_code)
+#undef SYSTEM_ERROR2_BENCH_MESSAGE
+// The same messages written into a stack buffer, which most domains do without allocating memory
+#define SYSTEM_ERROR2_BENCH_MESSAGE_INTO(name, maker)                                                                   \
+  BENCHMARK("message_into() system_code(" name ")")                                                                     \
+  {                                                                                                                     \
+    const system_code sc(maker());                                                                                      \
+    char buffer[256];                                                                                                   \
+    for(size_t n = 0; n < iterations; n++)                                                                              \
+    {                                                                                                                   \
+      bench::do_not_optimise(sc.message_into(buffer, sizeof(buffer)));                                                  \
+      bench::clobber_memory();                                                                                          \
+    }                                                                                                                   \
+  }
+SYSTEM_ERROR2_BENCH_MESSAGE_INTO("generic_code", make_generic)
+SYSTEM_ERROR2_BENCH_MESSAGE_INTO("posix_code", make_native)
+SYSTEM_ERROR2_BENCH_MESSAGE_INTO("nested", make_nested)
+SYSTEM_ERROR2_BENCH_MESSAGE_INTO("posix_code, uncached message", make_uncached_native)
+SYSTEM_ERROR2_BENCH_MESSAGE_INTO("std::error_code", make_std_error_code)
+SYSTEM_ERROR2_BENCH_MESSAGE_INTO("remote_nt_code", make_remote_nt)
+#undef SYSTEM_ERROR2_BENCH_MESSAGE_INTO
+// A log line of the name and message of a code, by iostreams and by fmt into a reused buffer
+BENCHMARK("operator<< system_code(posix_code) into std::ostringstream")
+{
+  const system_code sc(make_native());
+  std::ostringstream s;
+  for(size_t n = 0; n < iterations; n++)
+  {
+    s.str(std::string());
+    s << sc;
+    bench::do_not_optimise(s);
+  }
+}
+#ifdef BENCH_FMT_SUPPORT
+BENCHMARK("fmt::format_to() system_code(posix_code) into a buffer")
+{
+  const system_code sc(make_native());
+  char buffer[256];
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(fmt::format_to(buffer, "{}", sc));
+    bench::clobber_memory();
+  }
+}
+BENCHMARK("fmt::format_to() system_code(std::error_code) into a buffer")
+{
+  const system_code sc(make_std_error_code());
+  char buffer[256];
+  for(size_t n = 0; n < iterations; n++)
+  {
+    bench::do_not_optimise(fmt::format_to(buffer, "{}", sc));
+    bench::clobber_memory();
+  }
+}
+#endif
+// A request rendering a handful of dynamic messages for its log, with and without an arena released per request
+#define SYSTEM_ERROR2_BENCH_REQUEST_MESSAGES(name, render)                                                             \
+  BENCHMARK("message() x4 per request" name)                                                                           \
+  {                                                                                                                    \
+    const system_code scs[] = {make_uncached_native(), make_std_error_code(),                                          \
+                               system_code(std::error_code(long_message_errno_value, std::generic_category())),        \
+                               system_code(std::error_code(long_message_errno_value, std::system_category()))};        \
+    char buffer[512];                                                                                                  \
+    message_arena arena(buffer, sizeof(buffer));                                                                       \
+    for(size_t n = 0; n < iterations; n++)                                                                             \
+    {                                                                                                                  \
+      for(const auto &sc : scs)                                                                                        \
+      {                                                                                                                \
+        auto msg = render;                                                                                             \
+        bench::do_not_optimise(msg.data());                                                                            \
+      }                                                                                                                \
+      arena.release();                                                                                                 \
+    }                                                                                                                  \
+  }
+SYSTEM_ERROR2_BENCH_REQUEST_MESSAGES("", sc.message())
+SYSTEM_ERROR2_BENCH_REQUEST_MESSAGES(", message_arena", message(sc, arena))
+#undef SYSTEM_ERROR2_BENCH_REQUEST_MESSAGES
+
+/***** throw_exception() *****/
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS)
+#define SYSTEM_ERROR2_BENCH_THROW(name, maker)                                                                          \
+  BENCHMARK("throw_exception() system_code(" name ") and catch")                                                       \
+  {                                                                                                                    \
+    const system_code sc(maker());                                                                                     \
+    size_t count = 0;                                                                                                  \
+    for(size_t n = 0; n < iterations; n++)                                                                             \
+    {                                                                                                                  \
+      try                                                                                                              \
+      {                                                                                                                \
+        sc.throw_exception();                                                                                          \
+      }                                                                                                                \
+      catch(const status_error<void> &e)                                                                               \
+      {                                                                                                                \
+        count += e.code().failure();                                                                                   \
+      }                                                                                                                \
+    }                                                                                                                  \
+    bench::do_not_optimise(count);                                                                                     \
+  }
+SYSTEM_ERROR2_BENCH_THROW("generic_code", make_generic)
+SYSTEM_ERROR2_BENCH_THROW("posix_code", make_native)
+SYSTEM_ERROR2_BENCH_THROW("http_status_code", make_http)
+SYSTEM_ERROR2_BENCH_THROW("quick_status_code_from_enum", make_enum)
+SYSTEM_ERROR2_BENCH_THROW("nested", make_nested)
+SYSTEM_ERROR2_BENCH_THROW("posix_code, uncached message", make_uncached_native)
+#undef SYSTEM_ERROR2_BENCH_THROW
+BENCHMARK("throw_exception() system_code(posix_code, uncached message) and catch and what()")
+{
+  const system_code sc(make_uncached_native());
+  size_t count = 0;
+  for(size_t n = 0; n < iterations; n++)
+  {
+    try
+    {
+      sc.throw_exception();
+    }
+    catch(const status_error<void> &e)
+    {
+      count += (e.what()[0] != 0);
+    }
+  }
+  bench::do_not_optimise(count);
+}
+
+/***** system_code_from_exception() by registry versus by catch chain *****/
+namespace
+{
+  struct bench_exception : std::exception
+  {
+  };
+  struct bench_derived_exception : std::out_of_range
+  {
+    bench_derived_exception()
+        : std::out_of_range("derived")
+    {
+    }
+  };
+  const bool bench_exception_registered = register_system_code_from_exception<bench_exception>(
+  [](const std::exception & /*unused*/) -> system_code { return generic_code(errc::io_error); });
+  // As system_code_from_exception() was, without the hash table of exception types
+  system_code catch_chain(std::exception_ptr &&ep)
+  {
+    try
+    {
+      try
+      {
+        std::rethrow_exception(ep);
+      }
+      catch(const status_error<void> &e)
+      {
+        return system_code(in_place, e.code());
+      }
+      catch(...)
+      {
+        throw;
+      }
+    }
+    catch(const std::invalid_argument & /*unused*/)
+    {
+      return generic_code(errc::invalid_argument);
+    }
+    catch(const std::domain_error & /*unused*/)
+    {
+      return generic_code(errc::argument_out_of_domain);
+    }
+    catch(const std::length_error & /*unused*/)
+    {
+      return generic_code(errc::argument_list_too_long);
+    }
+    catch(const std::out_of_range & /*unused*/)
+    {
+      return generic_code(errc::result_out_of_range);
+    }
+    catch(const std::logic_error & /*unused*/)
+    {
+      return generic_code(errc::invalid_argument);
+    }
+    catch(const std::system_error &e)
+    {
+      return detail::system_code_from_std_system_error(e);
+    }
+    catch(const std::overflow_error & /*unused*/)
+    {
+      return generic_code(errc::value_too_large);
+    }
+    catch(const std::range_error & /*unused*/)
+    {
+      return generic_code(errc::result_out_of_range);
+    }
+    catch(const std::runtime_error & /*unused*/)
+    {
+      return generic_code(errc::resource_unavailable_try_again);
+    }
+    catch(const std::bad_alloc & /*unused*/)
+    {
+      return generic_code(errc::not_enough_memory);
+    }
+    catch(...)
+    {
+    }
+    return generic_code(errc::resource_unavailable_try_again);
+  }
+}  // namespace
+#define SYSTEM_ERROR2_BENCH_FROM_EXCEPTION(name, exception)                                                            \
+  BENCHMARK("system_code_from_exception(" name ") by registry")                                                        \
+  {                                                                                                                    \
+    const std::exception_ptr ep = std::make_exception_ptr(exception);                                                  \
+    size_t count = 0;                                                                                                  \
+    for(size_t n = 0; n < iterations; n++)                                                                             \
+    {                                                                                                                  \
+      count += system_code_from_exception(std::exception_ptr(ep)).failure();                                           \
+    }                                                                                                                  \
+    bench::do_not_optimise(count);                                                                                     \
+  }                                                                                                                    \
+  BENCHMARK("system_code_from_exception(" name ") by catch chain")                                                     \
+  {                                                                                                                    \
+    const std::exception_ptr ep = std::make_exception_ptr(exception);                                                  \
+    size_t count = 0;                                                                                                  \
+    for(size_t n = 0; n < iterations; n++)                                                                             \
+    {                                                                                                                  \
+      count += catch_chain(std::exception_ptr(ep)).failure();                                                          \
+    }                                                                                                                  \
+    bench::do_not_optimise(count);                                                                                     \
+  }
+SYSTEM_ERROR2_BENCH_FROM_EXCEPTION("std::invalid_argument", std::invalid_argument("x"))
+SYSTEM_ERROR2_BENCH_FROM_EXCEPTION("std::bad_alloc", std::bad_alloc())
+SYSTEM_ERROR2_BENCH_FROM_EXCEPTION("std::system_error", std::system_error(ENOENT, std::generic_category()))
+SYSTEM_ERROR2_BENCH_FROM_EXCEPTION("registered type", bench_exception())
+SYSTEM_ERROR2_BENCH_FROM_EXCEPTION("derived type", bench_derived_exception())
+#undef SYSTEM_ERROR2_BENCH_FROM_EXCEPTION
+#endif
@@ -0,0 +1,57 @@
+# Compiles SOURCE to x86-64 assembly with COMPILER and checks that every function whose name starts with
+# PREFIX contains neither a call nor a jump out of itself, except for those listed in HAS_CALLS, which must
+# contain one so we know calls would have been spotted.
+#
+# Run as: cmake -DCOMPILER=... -DSOURCE=... -DINCLUDE=... -DOUTPUT=... -DPREFIX=... -DHAS_CALLS=... -P CheckCodegen.cmake
+
+execute_process(
+  COMMAND "${COMPILER}" -std=c++14 -O2 -S -I "${INCLUDE}" "${SOURCE}" -o "${OUTPUT}"
+  RESULT_VARIABLE result
+  ERROR_VARIABLE errors
+)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "Failed to compile ${SOURCE} to assembly:\n${errors}")
+endif()
+
+file(STRINGS "${OUTPUT}" lines)
+set(functions)
+set(current)
+foreach(line IN LISTS lines)
+  if(line MATCHES "^([A-Za-z_][A-Za-z0-9_]*):")
+    set(current)
+    string(FIND "${CMAKE_MATCH_1}" "${PREFIX}" idx)
+    if(idx EQUAL 0)
+      set(current "${CMAKE_MATCH_1}")
+      list(APPEND functions "${current}")
+      set(calls_${current})
+    endif()
+  elseif(current AND line MATCHES "^[ \t]+\\.size[ \t]")
+    set(current)
+  elseif(current AND line MATCHES "^[ \t]+(call|jmp)q?[ \t]+([^.].*)$")
+    # Jumps to local labels begin with a dot, anything else is a call, a tail call or an indirect jump
+    list(APPEND calls_${current} "${CMAKE_MATCH_1} ${CMAKE_MATCH_2}")
+  endif()
+endforeach()
+
+list(LENGTH functions count)
+if(count EQUAL 0)
+  message(FATAL_ERROR "No functions beginning with ${PREFIX} were found in ${OUTPUT}")
+endif()
+foreach(function IN LISTS functions)
+  list(FIND HAS_CALLS "${function}" idx)
+  if(idx EQUAL -1)
+    if(calls_${function})
+      message(SEND_ERROR "${function} should contain no calls, but contains: ${calls_${function}}")
+    else()
+      message(STATUS "${function} contains no calls")
+    endif()
+  elseif(NOT calls_${function})
+    message(SEND_ERROR "${function} should contain a call, but none was found")
+  endif()
+endforeach()
+foreach(function IN LISTS HAS_CALLS)
+  list(FIND functions "${function}" idx)
+  if(idx EQUAL -1)
+    message(SEND_ERROR "${function} was not found in ${OUTPUT}")
+  endif()
+endforeach()
@@ -0,0 +1,266 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_ATOMIC_STATUS_CODE_HPP
+#define SYSTEM_ERROR2_ATOMIC_STATUS_CODE_HPP
+
+#include "system_code.hpp"
+
+#include <atomic>
+#include <cstring>  // for memcpy
+#include <new>      // for nothrow
+
+#ifndef SYSTEM_ERROR2_ATOMIC_STATUS_CODE_USE_DWCAS
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) && defined(__SIZEOF_INT128__) && __SIZEOF_POINTER__ == 8
+/*! True if `atomic_status_code` uses a double width compare and swap, else a lock. GCC and clang
+only predefine `__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16` on x64 when `cmpxchg16b` is enabled, as by
+`-mcx16` or a `-march` which implies it, so without one of those the lock is used.
+*/
+#define SYSTEM_ERROR2_ATOMIC_STATUS_CODE_USE_DWCAS 1
+#else
+#define SYSTEM_ERROR2_ATOMIC_STATUS_CODE_USE_DWCAS 0
+#endif
+#endif
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! \brief An atomic `system_code`, for many threads to race to report the first failure.
+
+As `system_code` is two words and move bitcopying, it can be stored and replaced
+as a whole by a double width compare and swap where the compiler has been told the
+platform has one. On x64 that needs `-mcx16`, or a `-march` which implies it, as
+without it the compiler assumes `cmpxchg16b` may be missing. `is_dwcas` says which
+is in use.
+
+Otherwise the code is guarded by a sequence counter. Readers take no lock, but
+retry while a write is in progress. Writers are serialised by spinning on the
+counter, so for them it is a spinlock: a writer preempted whilst writing stalls
+all other writers, and all readers, until it is scheduled again.
+
+The stored code is owned by the atomic. `load()` returns a clone via the domain's
+`_do_erased_copy()`. A code which owns a payload, such as a nested status code, is
+destroyed by whoever receives it from `exchange()`, so cloning it must not race
+with `exchange()`. Racing `try_set_first()` against `load()` is always safe, as
+the first code set is never modified.
+
+There is also a cancellation flag, set when `try_set_first()` succeeds or by
+`cancel()`, which workers can poll cheaply with `cancelled()`.
+*/
+class atomic_status_code
+{
+  struct _bits
+  {
+    const status_code_domain *domain;
+    intptr_t value;
+  };
+  static_assert(sizeof(_bits) == sizeof(system_code), "system_code is not a domain pointer and an intptr_t!");
+
+  static _bits _take(system_code &code) noexcept
+  {
+    _bits ret, empty{nullptr, 0};
+    memcpy(&ret, static_cast<const void *>(&code), sizeof(ret));
+    // system_code is move bitcopying, so the bits are moved out and the source left empty
+    memcpy(static_cast<void *>(&code), &empty, sizeof(empty));
+    return ret;
+  }
+  static system_code _make(_bits bits) noexcept
+  {
+    system_code ret;
+    if(bits.domain != nullptr)
+    {
+      memcpy(static_cast<void *>(&ret), &bits, sizeof(bits));
+    }
+    return ret;
+  }
+
+#if SYSTEM_ERROR2_ATOMIC_STATUS_CODE_USE_DWCAS
+  using _word = unsigned __int128;
+  alignas(16) _word _v{0};
+
+  static _word _to_word(_bits bits) noexcept
+  {
+    _word ret;
+    memcpy(&ret, &bits, sizeof(ret));
+    return ret;
+  }
+  static _bits _from_word(_word v) noexcept
+  {
+    _bits ret;
+    memcpy(&ret, &v, sizeof(ret));
+    return ret;
+  }
+  _bits _load() const noexcept
+  {
+    // A compare and swap which never swaps is the only atomic double width load
+    return _from_word(__sync_val_compare_and_swap(const_cast<_word *>(&_v), 0, 0));  // NOLINT
+  }
+  bool _compare_exchange(_bits &expected, _bits desired) noexcept
+  {
+    const _word e = _to_word(expected);
+    const _word was = __sync_val_compare_and_swap(&_v, e, _to_word(desired));
+    if(was == e)
+    {
+      return true;
+    }
+    expected = _from_word(was);
+    return false;
+  }
+#else
+  // Odd whilst being written
+  std::atomic<unsigned> _seq{0};
+  std::atomic<const status_code_domain *> _domain{nullptr};
+  std::atomic<intptr_t> _value{0};
+
+  _bits _load() const noexcept
+  {
+    for(;;)
+    {
+      const unsigned seq1 = _seq.load(std::memory_order_acquire);
+      if((seq1 & 1) == 0)
+      {
+        const _bits ret{_domain.load(std::memory_order_relaxed), _value.load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(_seq.load(std::memory_order_relaxed) == seq1)
+        {
+          return ret;
+        }
+      }
+    }
+  }
+  bool _compare_exchange(_bits &expected, _bits desired) noexcept
+  {
+    unsigned seq = _seq.load(std::memory_order_relaxed);
+    for(;;)
+    {
+      if((seq & 1) != 0)
+      {
+        seq = _seq.load(std::memory_order_relaxed);
+        continue;
+      }
+      if(_seq.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    const _bits current{_domain.load(std::memory_order_relaxed), _value.load(std::memory_order_relaxed)};
+    const bool ret = (current.domain == expected.domain && current.value == expected.value);
+    if(ret)
+    {
+      std::atomic_thread_fence(std::memory_order_release);
+      _domain.store(desired.domain, std::memory_order_relaxed);
+      _value.store(desired.value, std::memory_order_relaxed);
+    }
+    else
+    {
+      expected = current;
+    }
+    _seq.store(seq + 2, std::memory_order_release);
+    return ret;
+  }
+#endif
+
+  std::atomic<bool> _cancelled{false};
+
+public:
+  //! Default constructs to empty.
+  atomic_status_code() = default;
+  //! Constructs holding `code`.
+  explicit atomic_status_code(system_code &&code) noexcept
+  {
+    _bits expected{nullptr, 0};
+    _compare_exchange(expected, _take(code));
+  }
+  atomic_status_code(const atomic_status_code &) = delete;
+  atomic_status_code(atomic_status_code &&) = delete;
+  atomic_status_code &operator=(const atomic_status_code &) = delete;
+  atomic_status_code &operator=(atomic_status_code &&) = delete;
+  ~atomic_status_code() { (void) _make(_load()); }
+
+  //! True if the atomic uses a double width compare and swap, else a spinlock for writers.
+  static constexpr bool is_dwcas = SYSTEM_ERROR2_ATOMIC_STATUS_CODE_USE_DWCAS;
+
+  /*! If no code is stored, stores `code`, leaving it empty, sets the cancellation flag
+  and returns true. Else leaves `code` untouched and returns false, as it does if
+  `code` is empty.
+  */
+  bool try_set_first(system_code &&code) noexcept
+  {
+    if(code.empty() || !empty())
+    {
+      return false;
+    }
+    _bits expected{nullptr, 0}, desired;
+    memcpy(&desired, static_cast<const void *>(&code), sizeof(desired));
+    if(!_compare_exchange(expected, desired))
+    {
+      return false;
+    }
+    (void) _take(code);
+    _cancelled.store(true, std::memory_order_release);
+    return true;
+  }
+
+  //! True if no code is stored.
+  bool empty() const noexcept { return _load().domain == nullptr; }
+
+  //! Returns a clone of the stored code, or an empty code if there is none or the clone failed.
+  system_code load() const noexcept
+  {
+    const _bits bits = _load();
+    if(bits.domain == nullptr)
+    {
+      return {};
+    }
+    const void *image = &bits;
+    return system_code(std::nothrow, *static_cast<const status_code<void> *>(image));
+  }
+
+  //! Stores `code`, leaving it empty, and returns the code previously stored.
+  system_code exchange(system_code &&code) noexcept
+  {
+    const _bits desired = _take(code);
+    _bits expected = _load();
+    while(!_compare_exchange(expected, desired))
+    {
+    }
+    return _make(expected);
+  }
+
+  //! Sets the cancellation flag.
+  void cancel() noexcept { _cancelled.store(true, std::memory_order_release); }
+  //! True if the cancellation flag is set. A single relaxed load, so cheap enough to poll frequently.
+  bool cancelled() const noexcept { return _cancelled.load(std::memory_order_relaxed); }
+
+  //! Clears the stored code and the cancellation flag, returning the code previously stored.
+  system_code reset() noexcept
+  {
+    system_code ret = exchange(system_code());
+    _cancelled.store(false, std::memory_order_release);
+    return ret;
+  }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
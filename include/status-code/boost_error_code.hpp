@@ -37,6 +37,9 @@ http://www.boost.org/LICENSE_1_0.txt)
 
 #include <boost/system/error_code.hpp>
 #include <boost/system/system_error.hpp>
+#include <boost/version.hpp>
+
+#include "detail/lock_free_map.hpp"
 
 #include <system_error>
 
@@ -79,7 +82,7 @@ class _boost_error_code_domain final : public status_code_domain
 #endif
     {
       std::string msg = c.message();
-      return _base::atomic_refcounted_string_ref(msg.c_str(), msg.size());
+      return _base::_copied_string_ref(msg.c_str(), msg.size());
     }
 #if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
     catch(...)
@@ -105,7 +108,8 @@ public:
 
   //! Default constructor
   explicit _boost_error_code_domain(const _error_category_type &category) noexcept
-      : _base(0x0ea88ff382d94915 ^ reinterpret_cast<_base::unique_id_type>(&category))
+      : _base(0x0ea88ff382d94915 ^ reinterpret_cast<_base::unique_id_type>(&category),
+              _make_value_info<value_type>(value_info_t::failure_kind::nonzero))
       , _name("boost_error_code_domain(")
   {
     _name.append(category.name());
@@ -137,6 +141,7 @@ protected:
   virtual bool _do_equivalent(const status_code<void> &code1, const status_code<void> &code2) const noexcept override;
   virtual void _do_generic_code(_vtable_generic_code_args &args) const noexcept override;
   virtual int _do_message(_vtable_message_args &args) const noexcept override;
+  virtual int _do_message_into(_vtable_message_into_args &args) const noexcept override;
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
   SYSTEM_ERROR2_NORETURN virtual void _do_throw_exception(const status_code<void> &code) const override;
 #endif
@@ -147,60 +152,9 @@ namespace detail
   extern inline _boost_error_code_domain *
   boost_error_code_domain_from_category(const boost::system::error_category &category)
   {
-    static constexpr size_t max_items = 64;
-    static struct storage_t
-    {
-      std::atomic<unsigned> _lock;
-      union item_t
-      {
-        int _init;
-        _boost_error_code_domain domain;
-        constexpr item_t()
-            : _init(0)
-        {
-        }
-        ~item_t() {}
-      } items[max_items];
-      size_t count{0};
-
-      void lock()
-      {
-        while(_lock.exchange(1, std::memory_order_acquire) != 0)
-          ;
-      }
-      void unlock() { _lock.store(0, std::memory_order_release); }
-
-      storage_t() {}
-      ~storage_t()
-      {
-        lock();
-        for(size_t n = 0; n < count; n++)
-        {
-          items[n].domain.~_boost_error_code_domain();
-        }
-        unlock();
-      }
-      _boost_error_code_domain *add(const boost::system::error_category &category)
-      {
-        _boost_error_code_domain *ret = nullptr;
-        lock();
-        for(size_t n = 0; n < count; n++)
-        {
-          if(items[n].domain.error_category() == category)
-          {
-            ret = &items[n].domain;
-            break;
-          }
-        }
-        if(ret == nullptr && count < max_items)
-        {
-          ret = new(SYSTEM_ERROR2_ADDRESS_OF(items[count++].domain)) _boost_error_code_domain(category);
-        }
-        unlock();
-        return ret;
-      }
-    } storage;
-    return storage.add(category);
+    // Categories are singletons, so key on their address. Lookups are wait free.
+    static lock_free_map<const boost::system::error_category *, _boost_error_code_domain> storage;
+    return storage.find_or_emplace(SYSTEM_ERROR2_ADDRESS_OF(category), category);
   }
 }  // namespace detail
 
@@ -310,6 +264,24 @@ inline int _boost_error_code_domain::_do_message(_vtable_message_args &args) con
   return ret;
 }
 
+inline int _boost_error_code_domain::_do_message_into(_vtable_message_into_args &args) const noexcept
+{
+#if BOOST_VERSION >= 106900
+  assert(args.code.domain() == *this);
+  const auto &c = static_cast<const boost_error_code &>(args.code);  // NOLINT
+  if(args.length == 0)
+  {
+    return 0;
+  }
+  // Boost's categories can write their messages into a buffer without allocating
+  const char *msg = c.category().message(c.value(), args.buffer, args.length);
+  args.ret = (msg == args.buffer) ? strlen(msg) : _copy_string_into(args.buffer, args.length, msg, strlen(msg));
+  return 0;
+#else
+  return _base::_do_message_into(args);
+#endif
+}
+
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
 SYSTEM_ERROR2_NORETURN inline void _boost_error_code_domain::_do_throw_exception(const status_code<void> &code) const
 {
@@ -135,9 +135,21 @@ public:
   using _base::string_ref;
 
 public:
+  //! Describes this domain's values, see `status_code_domain::value_info_t`
+  static constexpr value_info_t _default_value_info() noexcept
+  {
+    return _make_value_info<value_type>(value_info_t::failure_kind::less, 0);
+  }
   //! Default constructor
   constexpr explicit _com_code_domain(typename _base::unique_id_type id = 0xdc8275428b4effac) noexcept
-      : _base(id)
+      : _base(id, _own_value_info(id, 0xdc8275428b4effac, _default_value_info()))
+  {
+  }
+  /*! Constructor for a domain derived from this one, which by passing `value_info` opts into
+  `failure()` and `equivalent()` being determined from it where possible.
+  */
+  constexpr _com_code_domain(typename _base::unique_id_type id, value_info_t value_info) noexcept
+      : _base(id, value_info)
   {
   }
   _com_code_domain(const _com_code_domain &) = default;
@@ -71,6 +71,17 @@ http://www.boost.org/LICENSE_1_0.txt)
 #define SYSTEM_ERROR2_ADDRESS_OF(...) (&__VA_ARGS__)
 #endif
 
+#ifndef SYSTEM_ERROR2_LITTLE_ENDIAN
+#if defined(_WIN32) || defined(__APPLE__) || __LITTLE_ENDIAN__ ||                                                      \
+(defined(__BYTE_ORDER) && defined(__LITTLE_ENDIAN) && __BYTE_ORDER == __LITTLE_ENDIAN) ||                             \
+(defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+//! True if the target is little endian, so the low bytes of an integer come first in memory.
+#define SYSTEM_ERROR2_LITTLE_ENDIAN 1
+#else
+#define SYSTEM_ERROR2_LITTLE_ENDIAN 0
+#endif
+#endif
+
 #ifndef SYSTEM_ERROR2_CONSTEXPR14
 #if defined(STANDARDESE_IS_IN_THE_HOUSE) || __cplusplus >= 201400 || _MSC_VER >= 1910 /* VS2017 */
 //! Defined to be `constexpr` when on C++ 14 or better compilers. Usually automatic, can be overriden.
@@ -362,6 +373,18 @@ namespace detail
   }
 #endif
 
+  /* True if called within a constant evaluation context. Before C++ 20 virtual functions
+  cannot be constexpr, so code wanting to avoid them during constant evaluation need not.
+  */
+  constexpr inline bool is_constant_evaluated() noexcept
+  {
+#if __cpp_lib_is_constant_evaluated >= 201811L
+    return std::is_constant_evaluated();
+#else
+    return false;
+#endif
+  }
+
   /* erasure_cast performs a bit_cast with additional rules to handle types
   of differing sizes. For integral & enum types, it may perform a narrowing
   or widing conversion with static_cast if necessary, before doing the final
@@ -409,8 +432,7 @@ namespace detail
     return bit_cast<To>(from);
   }
 
-#if defined(_WIN32) || defined(__APPLE__) || __LITTLE_ENDIAN__ ||                                                      \
-(defined(__BYTE_ORDER) && defined(__LITTLE_ENDIAN) && __BYTE_ORDER == __LITTLE_ENDIAN)
+#if SYSTEM_ERROR2_LITTLE_ENDIAN
   // We can avoid the type pun on little endian architectures which can aid optimisation
   SYSTEM_ERROR2_TEMPLATE(class To, class From, long = 5)
   SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(
@@ -0,0 +1,175 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_DETAIL_LOCK_FREE_MAP_HPP
+#define SYSTEM_ERROR2_DETAIL_LOCK_FREE_MAP_HPP
+
+#include "../config.hpp"
+
+#include <cstdint>
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  //! Mixes the bits of a pointer so its low bits are usable as a hash bucket index.
+  struct lock_free_map_pointer_hash
+  {
+    template <class T> size_t operator()(const T *p) const noexcept
+    {
+      auto x = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(p));
+      // Finaliser from MurmurHash3
+      x ^= x >> 33U;
+      x *= 0xff51afd7ed558ccdULL;
+      x ^= x >> 33U;
+      return static_cast<size_t>(x);
+    }
+  };
+
+  /*! \brief An unbounded, insert only, lock free map of keys to values.
+
+  Lookups are wait free: they perform acquire loads and walk a singly linked
+  list of nodes hanging off a fixed number of hash buckets. Insertions
+  allocate a node, then CAS it onto the front of its bucket's list. If a racing
+  insertion of the same key wins, the losing node is destroyed and the winner
+  returned. Nodes are never removed until the map is destroyed, so pointers to
+  values remain valid for the lifetime of the map.
+
+  This is intended for registries which are populated once per key and then
+  read on every operation thereafter, where the total number of keys is small
+  but not bounded.
+  */
+  template <class Key, class T, class Hash = lock_free_map_pointer_hash, size_t Buckets = 64> class lock_free_map
+  {
+    static_assert((Buckets & (Buckets - 1)) == 0, "Buckets must be a power of two");
+
+    struct node
+    {
+      const Key key;
+      T value;
+      node *next{nullptr};
+
+      template <class... Args>
+      explicit node(const Key &k, Args &&...args)
+          : key(k)
+          , value(static_cast<Args &&>(args)...)
+      {
+      }
+    };
+
+    std::atomic<node *> _buckets[Buckets];
+
+    std::atomic<node *> &_bucket(const Key &key) noexcept { return _buckets[Hash()(key) & (Buckets - 1)]; }
+    const std::atomic<node *> &_bucket(const Key &key) const noexcept { return _buckets[Hash()(key) & (Buckets - 1)]; }
+    static node *_find(node *begin, const node *end, const Key &key) noexcept
+    {
+      for(node *n = begin; n != end; n = n->next)
+      {
+        if(n->key == key)
+        {
+          return n;
+        }
+      }
+      return nullptr;
+    }
+
+  public:
+    //! Default constructor
+    lock_free_map() noexcept
+    {
+      for(auto &i : _buckets)
+      {
+        i.store(nullptr, std::memory_order_relaxed);
+      }
+    }
+    lock_free_map(const lock_free_map &) = delete;
+    lock_free_map(lock_free_map &&) = delete;
+    lock_free_map &operator=(const lock_free_map &) = delete;
+    lock_free_map &operator=(lock_free_map &&) = delete;
+    ~lock_free_map()
+    {
+      for(auto &i : _buckets)
+      {
+        node *n = i.exchange(nullptr, std::memory_order_acquire);
+        while(n != nullptr)
+        {
+          node *next = n->next;
+          delete n;
+          n = next;
+        }
+      }
+    }
+
+    //! Returns the value for `key`, or null if there is none. Wait free.
+    T *find(const Key &key) noexcept
+    {
+      node *n = _find(_bucket(key).load(std::memory_order_acquire), nullptr, key);
+      return (n != nullptr) ? &n->value : nullptr;
+    }
+    //! \overload
+    const T *find(const Key &key) const noexcept
+    {
+      const node *n = _find(_bucket(key).load(std::memory_order_acquire), nullptr, key);
+      return (n != nullptr) ? &n->value : nullptr;
+    }
+
+    /*! Returns the value for `key`, constructing it from `args` if there is none.
+    Lock free. Returns null if memory could not be allocated. Racing
+    insertions of the same key may construct a value which is then discarded,
+    but exactly one value per key is ever returned.
+    */
+    template <class... Args> T *find_or_emplace(const Key &key, Args &&...args)
+    {
+      auto &bucket = _bucket(key);
+      node *head = bucket.load(std::memory_order_acquire);
+      if(node *n = _find(head, nullptr, key))
+      {
+        return &n->value;
+      }
+      auto *newnode = new(std::nothrow) node(key, static_cast<Args &&>(args)...);
+      if(newnode == nullptr)
+      {
+        return nullptr;
+      }
+      const node *searched = head;
+      newnode->next = head;
+      while(!bucket.compare_exchange_weak(newnode->next, newnode, std::memory_order_acq_rel,
+                                          std::memory_order_acquire))
+      {
+        // Only the nodes added since we last looked need searching
+        if(node *n = _find(newnode->next, searched, key))
+        {
+          delete newnode;
+          return &n->value;
+        }
+        searched = newnode->next;
+      }
+      return &newnode->value;
+    }
+  };
+}  // namespace detail
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
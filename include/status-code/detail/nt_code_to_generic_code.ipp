@@ -1,98 +1,98 @@
-case 0x80000002: return EACCES;
-case 0x8000000f: return EAGAIN;
-case 0x80000010: return EAGAIN;
-case 0x80000011: return EBUSY;
-case 0xc0000002: return ENOSYS;
-case 0xc0000005: return EACCES;
-case 0xc0000008: return EINVAL;
-case 0xc000000e: return ENOENT;
-case 0xc000000f: return ENOENT;
-case 0xc0000010: return ENOSYS;
-case 0xc0000013: return EAGAIN;
-case 0xc0000017: return ENOMEM;
-case 0xc000001c: return ENOSYS;
-case 0xc000001e: return EACCES;
-case 0xc000001f: return EACCES;
-case 0xc0000021: return EACCES;
-case 0xc0000022: return EACCES;
-case 0xc0000024: return EINVAL;
-case 0xc0000033: return EINVAL;
-case 0xc0000034: return ENOENT;
-case 0xc0000035: return EEXIST;
-case 0xc0000037: return EINVAL;
-case 0xc000003a: return ENOENT;
-case 0xc0000040: return ENOMEM;
-case 0xc0000041: return EACCES;
-case 0xc0000042: return EINVAL;
-case 0xc0000043: return EACCES;
-case 0xc000004b: return EACCES;
-case 0xc0000054: return ENOLCK;
-case 0xc0000055: return ENOLCK;
-case 0xc0000056: return EACCES;
-case 0xc000007f: return ENOSPC;
-case 0xc0000087: return ENOMEM;
-case 0xc0000097: return ENOMEM;
-case 0xc000009b: return ENOENT;
-case 0xc000009e: return EAGAIN;
-case 0xc00000a2: return EACCES;
-case 0xc00000a3: return EAGAIN;
-case 0xc00000af: return ENOSYS;
-case 0xc00000ba: return EACCES;
-case 0xc00000c0: return ENODEV;
-case 0xc00000d4: return EXDEV;
-case 0xc00000d5: return EACCES;
-case 0xc00000fb: return ENOENT;
-case 0xc0000101: return ENOTEMPTY;
-case 0xc0000103: return EINVAL;
-case 0xc0000107: return EBUSY;
-case 0xc0000108: return EBUSY;
-case 0xc000010a: return EACCES;
-case 0xc000011f: return EMFILE;
-case 0xc0000120: return ECANCELED;
-case 0xc0000121: return EACCES;
-case 0xc0000123: return EACCES;
-case 0xc0000128: return EINVAL;
-case 0xc0000189: return EACCES;
-case 0xc00001ad: return ENOMEM;
-case 0xc000022d: return EAGAIN;
-case 0xc0000235: return EINVAL;
-case 0xc000026e: return EAGAIN;
-case 0xc000028a: return EACCES;
-case 0xc000028b: return EACCES;
-case 0xc000028d: return EACCES;
-case 0xc000028e: return EACCES;
-case 0xc000028f: return EACCES;
-case 0xc0000290: return EACCES;
-case 0xc000029c: return ENOSYS;
-case 0xc00002c5: return EACCES;
-case 0xc00002d3: return EAGAIN;
-case 0xc00002ea: return EACCES;
-case 0xc00002f0: return ENOENT;
-case 0xc0000373: return ENOMEM;
-case 0xc0000416: return ENOMEM;
-case 0xc0000433: return EBUSY;
-case 0xc0000434: return EBUSY;
-case 0xc0000455: return EINVAL;
-case 0xc0000467: return EACCES;
-case 0xc0000491: return ENOENT;
-case 0xc0000495: return EAGAIN;
-case 0xc0000503: return EAGAIN;
-case 0xc0000507: return EBUSY;
-case 0xc0000512: return EACCES;
-case 0xc000070a: return EINVAL;
-case 0xc000070b: return EINVAL;
-case 0xc000070c: return EINVAL;
-case 0xc000070d: return EINVAL;
-case 0xc000070e: return EINVAL;
-case 0xc000070f: return EINVAL;
-case 0xc0000710: return ENOSYS;
-case 0xc0000711: return ENOSYS;
-case 0xc0000716: return EINVAL;
-case 0xc000071b: return ENOSYS;
-case 0xc000071d: return ENOSYS;
-case 0xc000071e: return ENOSYS;
-case 0xc000071f: return ENOSYS;
-case 0xc0000720: return ENOSYS;
-case 0xc0000721: return ENOSYS;
-case 0xc000080f: return EAGAIN;
-case 0xc000a203: return EACCES;
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x80000002, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x8000000f, EAGAIN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x80000010, EAGAIN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x80000011, EBUSY)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000002, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000005, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000008, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000000e, ENOENT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000000f, ENOENT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000010, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000013, EAGAIN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000017, ENOMEM)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000001c, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000001e, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000001f, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000021, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000022, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000024, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000033, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000034, ENOENT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000035, EEXIST)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000037, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000003a, ENOENT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000040, ENOMEM)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000041, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000042, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000043, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000004b, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000054, ENOLCK)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000055, ENOLCK)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000056, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000007f, ENOSPC)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000087, ENOMEM)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000097, ENOMEM)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000009b, ENOENT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000009e, EAGAIN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc00000a2, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc00000a3, EAGAIN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc00000af, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc00000ba, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc00000c0, ENODEV)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc00000d4, EXDEV)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc00000d5, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc00000fb, ENOENT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000101, ENOTEMPTY)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000103, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000107, EBUSY)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000108, EBUSY)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000010a, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000011f, EMFILE)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000120, ECANCELED)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000121, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000123, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000128, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000189, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc00001ad, ENOMEM)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000022d, EAGAIN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000235, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000026e, EAGAIN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000028a, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000028b, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000028d, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000028e, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000028f, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000290, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000029c, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc00002c5, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc00002d3, EAGAIN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc00002ea, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc00002f0, ENOENT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000373, ENOMEM)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000416, ENOMEM)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000433, EBUSY)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000434, EBUSY)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000455, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000467, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000491, ENOENT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000495, EAGAIN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000503, EAGAIN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000507, EBUSY)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000512, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000070a, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000070b, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000070c, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000070d, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000070e, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000070f, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000710, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000711, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000716, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000071b, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000071d, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000071e, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000071f, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000720, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc0000721, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000080f, EAGAIN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc000a203, EACCES)
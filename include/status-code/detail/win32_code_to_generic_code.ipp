@@ -1,75 +1,75 @@
-case 0x1: return ENOSYS;
-case 0x2: return ENOENT;
-case 0x3: return ENOENT;
-case 0x4: return EMFILE;
-case 0x5: return EACCES;
-case 0x6: return EINVAL;
-case 0x8: return ENOMEM;
-case 0xc: return EACCES;
-case 0xe: return ENOMEM;
-case 0xf: return ENODEV;
-case 0x10: return EACCES;
-case 0x11: return EXDEV;
-case 0x13: return EACCES;
-case 0x14: return ENODEV;
-case 0x15: return EAGAIN;
-case 0x19: return EIO;
-case 0x1d: return EIO;
-case 0x1e: return EIO;
-case 0x20: return EACCES;
-case 0x21: return ENOLCK;
-case 0x27: return ENOSPC;
-case 0x37: return ENODEV;
-case 0x50: return EEXIST;
-case 0x52: return EACCES;
-case 0x57: return EINVAL;
-case 0x6e: return EIO;
-case 0x6f: return ENAMETOOLONG;
-case 0x70: return ENOSPC;
-case 0x7b: return EINVAL;
-case 0x83: return EINVAL;
-case 0x8e: return EBUSY;
-case 0x91: return ENOTEMPTY;
-case 0xaa: return EBUSY;
-case 0xb7: return EEXIST;
-case 0xd4: return ENOLCK;
-case 0x10b: return EINVAL;
-case 0x3e3: return ECANCELED;
-case 0x3e6: return EACCES;
-case 0x3f3: return EIO;
-case 0x3f4: return EIO;
-case 0x3f5: return EIO;
-case 0x4d5: return EAGAIN;
-case 0x961: return EBUSY;
-case 0x964: return EBUSY;
-case 0x2714: return EINTR;
-case 0x2719: return EBADF;
-case 0x271d: return EACCES;
-case 0x271e: return EFAULT;
-case 0x2726: return EINVAL;
-case 0x2728: return EMFILE;
-case 0x2733: return EWOULDBLOCK;
-case 0x2734: return EINPROGRESS;
-case 0x2735: return EALREADY;
-case 0x2736: return ENOTSOCK;
-case 0x2737: return EDESTADDRREQ;
-case 0x2738: return EMSGSIZE;
-case 0x2739: return EPROTOTYPE;
-case 0x273a: return ENOPROTOOPT;
-case 0x273b: return EPROTONOSUPPORT;
-case 0x273d: return EOPNOTSUPP;
-case 0x273f: return EAFNOSUPPORT;
-case 0x2740: return EADDRINUSE;
-case 0x2741: return EADDRNOTAVAIL;
-case 0x2742: return ENETDOWN;
-case 0x2743: return ENETUNREACH;
-case 0x2744: return ENETRESET;
-case 0x2745: return ECONNABORTED;
-case 0x2746: return ECONNRESET;
-case 0x2747: return ENOBUFS;
-case 0x2748: return EISCONN;
-case 0x2749: return ENOTCONN;
-case 0x274c: return ETIMEDOUT;
-case 0x274d: return ECONNREFUSED;
-case 0x274f: return ENAMETOOLONG;
-case 0x2751: return EHOSTUNREACH;
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x1, ENOSYS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2, ENOENT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x3, ENOENT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x4, EMFILE)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x5, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x6, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x8, ENOMEM)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xc, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xe, ENOMEM)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xf, ENODEV)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x10, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x11, EXDEV)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x13, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x14, ENODEV)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x15, EAGAIN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x19, EIO)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x1d, EIO)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x1e, EIO)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x20, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x21, ENOLCK)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x27, ENOSPC)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x37, ENODEV)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x50, EEXIST)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x52, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x57, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x6e, EIO)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x6f, ENAMETOOLONG)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x70, ENOSPC)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x7b, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x83, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x8e, EBUSY)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x91, ENOTEMPTY)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xaa, EBUSY)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xb7, EEXIST)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0xd4, ENOLCK)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x10b, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x3e3, ECANCELED)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x3e6, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x3f3, EIO)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x3f4, EIO)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x3f5, EIO)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x4d5, EAGAIN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x961, EBUSY)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x964, EBUSY)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2714, EINTR)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2719, EBADF)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x271d, EACCES)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x271e, EFAULT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2726, EINVAL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2728, EMFILE)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2733, EWOULDBLOCK)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2734, EINPROGRESS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2735, EALREADY)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2736, ENOTSOCK)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2737, EDESTADDRREQ)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2738, EMSGSIZE)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2739, EPROTOTYPE)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x273a, ENOPROTOOPT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x273b, EPROTONOSUPPORT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x273d, EOPNOTSUPP)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x273f, EAFNOSUPPORT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2740, EADDRINUSE)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2741, EADDRNOTAVAIL)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2742, ENETDOWN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2743, ENETUNREACH)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2744, ENETRESET)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2745, ECONNABORTED)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2746, ECONNRESET)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2747, ENOBUFS)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2748, EISCONN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2749, ENOTCONN)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x274c, ETIMEDOUT)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x274d, ECONNREFUSED)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x274f, ENAMETOOLONG)
+SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x2751, EHOSTUNREACH)
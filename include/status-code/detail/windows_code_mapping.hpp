@@ -0,0 +1,193 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#ifndef SYSTEM_ERROR2_DETAIL_WINDOWS_CODE_MAPPING_HPP
+#define SYSTEM_ERROR2_DETAIL_WINDOWS_CODE_MAPPING_HPP
+
+#include "../config.hpp"
+
+#include <cerrno>  // for error constants
+#include <cstdint>
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  //! The mapping of one Windows error code onto another code.
+  struct windows_code_mapping
+  {
+    uint32_t from;
+    uint32_t to;
+  };
+
+  /* The mapping tables are generated by utils/generate-tables.cpp, and are sorted by `from`.
+  They need nothing from Windows, so codes received from Windows machines can be mapped on any
+  platform.
+  */
+#define SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(from, to) {from, to},
+  //! NT kernel codes which have a Win32 code equivalent
+  constexpr windows_code_mapping nt_code_to_win32_code_table[] = {
+#include "nt_code_to_win32_code.ipp"
+  };
+  //! NT kernel codes which have a `errno` equivalent
+  constexpr windows_code_mapping nt_code_to_generic_code_table[] = {
+#include "nt_code_to_generic_code.ipp"
+  };
+  //! Win32 codes which have a `errno` equivalent
+  constexpr windows_code_mapping win32_code_to_generic_code_table[] = {
+#include "win32_code_to_generic_code.ipp"
+  };
+#undef SYSTEM_ERROR2_WINDOWS_CODE_MAPPING
+
+  /*! Returns what `key` maps onto in `table`, or `notfound` if it is not in the table.
+
+  This is a binary search without data dependent branches: each halving of the range is a
+  conditional move, so the number of steps depends only upon the size of the table, and none
+  of them can be mispredicted.
+  */
+  template <size_t N>
+  SYSTEM_ERROR2_CONSTEXPR14 inline uint32_t windows_code_map(const windows_code_mapping (&table)[N], uint32_t key,
+                                                             uint32_t notfound) noexcept
+  {
+    const windows_code_mapping *first = table;
+    size_t count = N;
+    while(count > 1)
+    {
+      const size_t half = count / 2;
+      first = (first[half].from <= key) ? first + half : first;
+      count -= half;
+    }
+    return (first->from == key) ? first->to : notfound;
+  }
+
+#if __cplusplus >= 201400 || _MSC_VER >= 1910 /* VS2017 */
+  /*! A hash index of a mapping table with `B` buckets, `B` being a power of two. The entries of the
+  table are grouped by bucket, so mapping a code examines only the few entries in its bucket, rather
+  than the dozen or so steps of a binary search of the whole table.
+  */
+  template <size_t N, size_t B> struct windows_code_index
+  {
+    static_assert((B & (B - 1)) == 0, "bucket count must be a power of two");
+    static_assert(N < 65536, "offsets must fit into sixteen bits");
+
+    static constexpr size_t bucket(uint32_t key) noexcept
+    {
+      return static_cast<size_t>((key * 0x9e3779b1U) >> 16U) & (B - 1);
+    }
+
+    uint16_t offsets[B + 1];  // entries of bucket b are [offsets[b], offsets[b + 1])
+    windows_code_mapping entries[N];
+  };
+  //! The number of buckets to use for a table of `n` entries, which is the next power of two.
+  constexpr size_t windows_code_index_buckets(size_t n, size_t b = 1) noexcept
+  {
+    return (b >= n) ? b : windows_code_index_buckets(n, b * 2);
+  }
+  //! Builds the hash index of a mapping table at compile time.
+  template <size_t N, size_t B = windows_code_index_buckets(N)>
+  constexpr windows_code_index<N, B> make_windows_code_index(const windows_code_mapping (&table)[N]) noexcept
+  {
+    using index_type = windows_code_index<N, B>;
+    index_type ret{};
+    for(size_t n = 0; n < N; n++)
+    {
+      ret.offsets[index_type::bucket(table[n].from) + 1]++;
+    }
+    for(size_t b = 0; b < B; b++)
+    {
+      ret.offsets[b + 1] += ret.offsets[b];
+    }
+    uint16_t next[B]{};
+    for(size_t b = 0; b < B; b++)
+    {
+      next[b] = ret.offsets[b];
+    }
+    for(size_t n = 0; n < N; n++)
+    {
+      ret.entries[next[index_type::bucket(table[n].from)]++] = table[n];
+    }
+    return ret;
+  }
+  //! Returns what `key` maps onto in `index`, or `notfound` if it is not in the table indexed.
+  template <size_t N, size_t B>
+  constexpr uint32_t windows_code_map(const windows_code_index<N, B> &index, uint32_t key, uint32_t notfound) noexcept
+  {
+    const size_t b = windows_code_index<N, B>::bucket(key);
+    for(size_t n = index.offsets[b]; n < index.offsets[b + 1]; n++)
+    {
+      if(index.entries[n].from == key)
+      {
+        return index.entries[n].to;
+      }
+    }
+    return notfound;
+  }
+
+  constexpr auto nt_code_to_win32_code_index = make_windows_code_index(nt_code_to_win32_code_table);
+  constexpr auto nt_code_to_generic_code_index = make_windows_code_index(nt_code_to_generic_code_table);
+  constexpr auto win32_code_to_generic_code_index = make_windows_code_index(win32_code_to_generic_code_table);
+  // The mappings are looked up by hash index where it can be built at compile time
+  constexpr const auto &nt_code_to_win32_code_lookup = nt_code_to_win32_code_index;
+  constexpr const auto &nt_code_to_generic_code_lookup = nt_code_to_generic_code_index;
+  constexpr const auto &win32_code_to_generic_code_lookup = win32_code_to_generic_code_index;
+#else
+  // Otherwise by binary search of the mapping table
+  constexpr const auto &nt_code_to_win32_code_lookup = nt_code_to_win32_code_table;
+  constexpr const auto &nt_code_to_generic_code_lookup = nt_code_to_generic_code_table;
+  constexpr const auto &win32_code_to_generic_code_lookup = win32_code_to_generic_code_table;
+#endif
+
+  //! The `errno` equivalent of an NT kernel code, zero if it is a success, -1 if it has none.
+  SYSTEM_ERROR2_CONSTEXPR14 inline int nt_code_to_errno(uint32_t c) noexcept
+  {
+    if(static_cast<int32_t>(c) >= 0)
+    {
+      return 0;  // success
+    }
+    return static_cast<int>(windows_code_map(nt_code_to_generic_code_lookup, c, static_cast<uint32_t>(-1)));
+  }
+  //! The Win32 code equivalent of an NT kernel code, zero if it is a success, -1 if it has none.
+  SYSTEM_ERROR2_CONSTEXPR14 inline uint32_t nt_code_to_win32_code(uint32_t c) noexcept
+  {
+    if(static_cast<int32_t>(c) >= 0)
+    {
+      return 0;  // success
+    }
+    return windows_code_map(nt_code_to_win32_code_lookup, c, static_cast<uint32_t>(-1));
+  }
+  //! The `errno` equivalent of a Win32 code, zero if it is a success, -1 if it has none.
+  SYSTEM_ERROR2_CONSTEXPR14 inline int win32_code_to_errno(uint32_t c) noexcept
+  {
+    if(c == 0)
+    {
+      return 0;
+    }
+    return static_cast<int>(windows_code_map(win32_code_to_generic_code_lookup, c, static_cast<uint32_t>(-1)));
+  }
+}  // namespace detail
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
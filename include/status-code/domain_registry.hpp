@@ -0,0 +1,230 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_DOMAIN_REGISTRY_HPP
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_HPP
+
+#include "http_status_code.hpp"
+#include "remote_com_code.hpp"
+#include "system_code.hpp"
+
+#if !defined(SYSTEM_ERROR2_NOT_POSIX) && !defined(_WIN32)
+#include "getaddrinfo_code.hpp"
+#endif
+
+#include "detail/lock_free_map.hpp"
+
+#include <new>  // for placement new
+
+#ifndef SYSTEM_ERROR2_DOMAIN_REGISTRY_CAPACITY
+//! The maximum number of domains which can be given a small index. Cannot exceed 65535.
+#define SYSTEM_ERROR2_DOMAIN_REGISTRY_CAPACITY 1024
+#endif
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  //! Domain ids are already random, so their low bits suffice as a hash bucket index.
+  struct domain_registry_id_hash
+  {
+    size_t operator()(status_code_domain::unique_id_type id) const noexcept { return static_cast<size_t>(id); }
+  };
+
+  /*! \brief A process wide registry of status code domains by unique id.
+
+  Each distinct domain id registered is given a small dense index, handed out in
+  order of first registration starting from one, zero meaning no domain. The first
+  instance registered for an id is the one returned by lookups, as domains with
+  equal ids compare equal.
+
+  Looking up the domain for an index is a single acquire load. Looking up the index
+  for an id is a wait free hash map lookup. Registering an id for the first time
+  is a lock free insertion.
+
+  The registry is never destroyed, so packing, unpacking and lookups remain valid
+  during static destruction. The built-in domains are not registered until first
+  looked up, so using the registry runs no dynamic initialiser.
+  */
+  class domain_registry
+  {
+    static_assert(SYSTEM_ERROR2_DOMAIN_REGISTRY_CAPACITY <= 65535,
+                  "SYSTEM_ERROR2_DOMAIN_REGISTRY_CAPACITY cannot exceed 65535");
+
+    std::atomic<const status_code_domain *> _domains[SYSTEM_ERROR2_DOMAIN_REGISTRY_CAPACITY + 1];
+    std::atomic<size_t> _count{1};
+    lock_free_map<status_code_domain::unique_id_type, std::atomic<size_t>, domain_registry_id_hash> _indices;
+
+    domain_registry() noexcept
+    {
+      for(auto &i : _domains)
+      {
+        i.store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+  public:
+    domain_registry(const domain_registry &) = delete;
+    domain_registry(domain_registry &&) = delete;
+    domain_registry &operator=(const domain_registry &) = delete;
+    domain_registry &operator=(domain_registry &&) = delete;
+    ~domain_registry() = delete;
+
+    //! The maximum index which can be handed out.
+    static constexpr size_t capacity = SYSTEM_ERROR2_DOMAIN_REGISTRY_CAPACITY;
+
+    //! Returns the process wide registry.
+    static domain_registry &get() noexcept
+    {
+      alignas(domain_registry) static char storage[sizeof(domain_registry)];
+      static domain_registry *const v = new(storage) domain_registry;
+      return *v;
+    }
+
+    //! Returns the domain with index `idx`, or null if there is none.
+    const status_code_domain *domain(size_t idx) const noexcept
+    {
+      return (idx <= capacity) ? _domains[idx].load(std::memory_order_acquire) : nullptr;
+    }
+
+    //! Returns the index of the domain with unique id `id` if it has been registered, else zero.
+    size_t find(status_code_domain::unique_id_type id) const noexcept
+    {
+      const auto *idx = _indices.find(id);
+      return (idx != nullptr) ? idx->load(std::memory_order_acquire) : 0;
+    }
+
+    /*! Returns the index of the id of `domain`, registering `domain` if the id has none.
+    Returns zero if the registry is full or memory could not be allocated.
+    */
+    size_t add(const status_code_domain *domain) noexcept
+    {
+      auto *idx = _indices.find_or_emplace(domain->id(), 0);
+      if(idx == nullptr)
+      {
+        return 0;
+      }
+      size_t ret = idx->load(std::memory_order_acquire);
+      if(ret != 0)
+      {
+        return ret;
+      }
+      const size_t newidx = _count.fetch_add(1, std::memory_order_relaxed);
+      if(newidx > capacity)
+      {
+        _count.store(capacity + 1, std::memory_order_relaxed);
+        return 0;
+      }
+      _domains[newidx].store(domain, std::memory_order_release);
+      // If we lost a race to register this id, our index is left unused
+      if(!idx->compare_exchange_strong(ret, newidx, std::memory_order_acq_rel, std::memory_order_acquire))
+      {
+        _domains[newidx].store(nullptr, std::memory_order_release);
+        return ret;
+      }
+      return newidx;
+    }
+  };
+
+  /* Returns the built-in domain with unique id `id`, or null if it is not one. The
+  table is constant initialised, so no domain registers itself during static
+  initialisation.
+  */
+  inline const status_code_domain *builtin_status_code_domain(status_code_domain::unique_id_type id) noexcept
+  {
+    static constexpr const status_code_domain *domains[] = {
+    &generic_code_domain, &http_status_code_domain, &remote_win32_code_domain, &remote_nt_code_domain,
+    &remote_com_code_domain,
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+    &posix_code_domain,
+#ifndef _WIN32
+    &getaddrinfo_code_domain,
+#endif
+#endif
+#ifdef _WIN32
+    &win32_code_domain, &nt_code_domain,
+#endif
+    };
+    for(const auto *domain : domains)
+    {
+      if(domain->id() == id)
+      {
+        return domain;
+      }
+    }
+    return nullptr;
+  }
+
+  // Returns the index of unique id `id`, registering the built-in domain with that id upon first being looked up
+  inline size_t status_code_domain_index_from_id(status_code_domain::unique_id_type id) noexcept
+  {
+    auto &registry = domain_registry::get();
+    const size_t idx = registry.find(id);
+    if(idx != 0)
+    {
+      return idx;
+    }
+    const status_code_domain *builtin = builtin_status_code_domain(id);
+    return (builtin != nullptr) ? registry.add(builtin) : 0;
+  }
+}  // namespace detail
+
+/*! \brief Registers `domain` with the process wide domain registry, returning its
+small dense index, or zero if the registry is full or memory could not be allocated.
+
+The built-in generic, POSIX, HTTP, getaddrinfo and remote Win32, NT and COM domains,
+and on Windows the Win32 and NT domains, are registered upon first being looked up
+by id or index. Other domains, including those of `quick_status_code_from_enum`, are
+registered upon first being packed into a `packed_status_code` or serialised by
+`serialise_status_code()`, and must otherwise be registered before they can be
+looked up by id. Registering a domain whose id has already been registered returns
+the existing index and does not replace the domain.
+*/
+inline size_t register_status_code_domain(const status_code_domain &domain) noexcept
+{
+  return detail::domain_registry::get().add(&domain);
+}
+
+/*! Returns the registered domain with unique id `id`, or null if there is none. Wait
+free, except upon the first lookup of a built-in domain, which registers it.
+*/
+inline const status_code_domain *status_code_domain_from_id(status_code_domain::unique_id_type id) noexcept
+{
+  const size_t idx = detail::status_code_domain_index_from_id(id);
+  // If the registry is full, built-in domains are still found
+  return (idx != 0) ? detail::domain_registry::get().domain(idx) : detail::builtin_status_code_domain(id);
+}
+
+/*! Returns the small dense index of the registered domain with the same id as `domain`,
+or zero if there is none. Indices run from one to `SYSTEM_ERROR2_DOMAIN_REGISTRY_CAPACITY`,
+and are specific to this process.
+*/
+inline size_t status_code_domain_index(const status_code_domain &domain) noexcept
+{
+  return detail::status_code_domain_index_from_id(domain.id());
+}
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
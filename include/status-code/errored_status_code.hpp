@@ -328,37 +328,39 @@ namespace traits
 template <class DomainType1, class DomainType2>
 inline bool operator==(const errored_status_code<DomainType1> &a, const errored_status_code<DomainType2> &b) noexcept
 {
-  return a.equivalent(static_cast<const status_code<DomainType2> &>(b));
+  return detail::dispatch_equivalent(static_cast<const status_code<DomainType1> &>(a),
+                                     static_cast<const status_code<DomainType2> &>(b));
 }
 //! True if the status code's are semantically equal via `equivalent()`.
 template <class DomainType1, class DomainType2>
 inline bool operator==(const status_code<DomainType1> &a, const errored_status_code<DomainType2> &b) noexcept
 {
-  return a.equivalent(static_cast<const status_code<DomainType2> &>(b));
+  return detail::dispatch_equivalent(a, static_cast<const status_code<DomainType2> &>(b));
 }
 //! True if the status code's are semantically equal via `equivalent()`.
 template <class DomainType1, class DomainType2>
 inline bool operator==(const errored_status_code<DomainType1> &a, const status_code<DomainType2> &b) noexcept
 {
-  return static_cast<const status_code<DomainType1> &>(a).equivalent(b);
+  return detail::dispatch_equivalent(static_cast<const status_code<DomainType1> &>(a), b);
 }
 //! True if the status code's are not semantically equal via `equivalent()`.
 template <class DomainType1, class DomainType2>
 inline bool operator!=(const errored_status_code<DomainType1> &a, const errored_status_code<DomainType2> &b) noexcept
 {
-  return !a.equivalent(static_cast<const status_code<DomainType2> &>(b));
+  return !detail::dispatch_equivalent(static_cast<const status_code<DomainType1> &>(a),
+                                      static_cast<const status_code<DomainType2> &>(b));
 }
 //! True if the status code's are not semantically equal via `equivalent()`.
 template <class DomainType1, class DomainType2>
 inline bool operator!=(const status_code<DomainType1> &a, const errored_status_code<DomainType2> &b) noexcept
 {
-  return !a.equivalent(static_cast<const status_code<DomainType2> &>(b));
+  return !detail::dispatch_equivalent(a, static_cast<const status_code<DomainType2> &>(b));
 }
 //! True if the status code's are not semantically equal via `equivalent()`.
 template <class DomainType1, class DomainType2>
 inline bool operator!=(const errored_status_code<DomainType1> &a, const status_code<DomainType2> &b) noexcept
 {
-  return !static_cast<const status_code<DomainType1> &>(a).equivalent(b);
+  return !detail::dispatch_equivalent(static_cast<const status_code<DomainType1> &>(a), b);
 }
 //! True if the status code's are semantically equal via `equivalent()` to `make_status_code(T)`.
 SYSTEM_ERROR2_TEMPLATE(class DomainType1, class T,  //
@@ -367,7 +369,7 @@ SYSTEM_ERROR2_TEMPLATE(class DomainType1, class T,  //
 SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(is_status_code<MakeStatusCodeResult>::value))  // ADL makes a status code
 inline bool operator==(const errored_status_code<DomainType1> &a, const T &b)
 {
-  return a.equivalent(make_status_code(b));
+  return detail::dispatch_equivalent(static_cast<const status_code<DomainType1> &>(a), make_status_code(b));
 }
 //! True if the status code's are semantically equal via `equivalent()` to `make_status_code(T)`.
 SYSTEM_ERROR2_TEMPLATE(class T, class DomainType1,  //
@@ -376,7 +378,7 @@ SYSTEM_ERROR2_TEMPLATE(class T, class DomainType1,  //
 SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(is_status_code<MakeStatusCodeResult>::value))  // ADL makes a status code
 inline bool operator==(const T &a, const errored_status_code<DomainType1> &b)
 {
-  return b.equivalent(make_status_code(a));
+  return detail::dispatch_equivalent(static_cast<const status_code<DomainType1> &>(b), make_status_code(a));
 }
 //! True if the status code's are not semantically equal via `equivalent()` to `make_status_code(T)`.
 SYSTEM_ERROR2_TEMPLATE(class DomainType1, class T,  //
@@ -385,7 +387,7 @@ SYSTEM_ERROR2_TEMPLATE(class DomainType1, class T,  //
 SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(is_status_code<MakeStatusCodeResult>::value))  // ADL makes a status code
 inline bool operator!=(const errored_status_code<DomainType1> &a, const T &b)
 {
-  return !a.equivalent(make_status_code(b));
+  return !detail::dispatch_equivalent(static_cast<const status_code<DomainType1> &>(a), make_status_code(b));
 }
 //! True if the status code's are semantically equal via `equivalent()` to `make_status_code(T)`.
 SYSTEM_ERROR2_TEMPLATE(class T, class DomainType1,  //
@@ -394,7 +396,7 @@ SYSTEM_ERROR2_TEMPLATE(class T, class DomainType1,  //
 SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(is_status_code<MakeStatusCodeResult>::value))  // ADL makes a status code
 inline bool operator!=(const T &a, const errored_status_code<DomainType1> &b)
 {
-  return !b.equivalent(make_status_code(a));
+  return !detail::dispatch_equivalent(static_cast<const status_code<DomainType1> &>(b), make_status_code(a));
 }
 //! True if the status code's are semantically equal via `equivalent()` to
 //! `quick_status_code_from_enum<T>::code_type(b)`.
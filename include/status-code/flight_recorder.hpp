@@ -0,0 +1,349 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_FLIGHT_RECORDER_HPP
+#define SYSTEM_ERROR2_FLIGHT_RECORDER_HPP
+
+#include "status_code.hpp"
+
+#include <chrono>
+#include <new>  // for nothrow
+
+#ifndef _WIN32
+#include <unistd.h>  // for write
+#endif
+
+#ifndef SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE
+//! The number of most recent errors kept per thread by `flight_recorder`. Must be a power of two.
+#define SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE 64
+#endif
+
+#ifndef SYSTEM_ERROR2_FLIGHT_RECORDER_TIMESTAMP
+//! Returns the timestamp of an error recorded by `flight_recorder` as a `long long`. Defaults to nanoseconds since
+//! the system clock's epoch, but can be redefined to something cheaper, such as a CPU cycle counter.
+#define SYSTEM_ERROR2_FLIGHT_RECORDER_TIMESTAMP()                                                                      \
+  static_cast<long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(                                         \
+                         std::chrono::system_clock::now().time_since_epoch())                                          \
+                         .count())
+#endif
+
+//! Records `code` with the `flight_recorder`, along with the source location.
+#define SYSTEM_ERROR2_FLIGHT_RECORD(code) SYSTEM_ERROR2_NAMESPACE::flight_recorder::record((code), __FILE__, __LINE__)
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+//! An error recorded by `flight_recorder`.
+struct flight_recorder_record
+{
+  unsigned long long sequence;                   //!< The number of errors recorded by the ring before this one
+  status_code_domain::unique_id_type domain_id;  //!< The unique id of the domain
+  long long value;                               //!< The integral value, or zero if the domain's value is not integral
+  long long timestamp;                           //!< From `SYSTEM_ERROR2_FLIGHT_RECORDER_TIMESTAMP()`
+  const char *file;                              //!< The source file, or null
+  unsigned line;                                 //!< The source line, or zero
+};
+
+/*! \brief A lock free recorder of the most recent errors of each thread.
+
+Each thread records into its own ring of the last `SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE`
+errors. Recording is a sequence of relaxed stores bracketed by two stores to the
+slot's sequence number, with no locks, allocations nor read-modify-writes. Only the
+first error recorded by a thread may allocate, to obtain a ring, unless
+`thread_init()` was called beforehand.
+
+The rings of all threads can be read at any time by any thread, including from a
+signal handler, by `for_each()` or `dump()`. Records being overwritten as they are
+read are skipped. When a thread exits, its ring and records are kept until reused
+by a new thread, so the errors of exited threads also appear.
+
+The file name must be a string with static storage duration, such as `__FILE__`.
+`SYSTEM_ERROR2_FLIGHT_RECORD(code)` supplies the source location.
+*/
+class flight_recorder
+{
+  static_assert((SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE & (SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE - 1)) == 0,
+                "SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE must be a power of two");
+
+  struct _slot
+  {
+    // Zero whilst being written, else one more than the record's sequence
+    std::atomic<unsigned long long> seq{0};
+    std::atomic<unsigned long long> domain_id{0};
+    std::atomic<long long> value{0};
+    std::atomic<long long> timestamp{0};
+    std::atomic<const char *> file{nullptr};
+    std::atomic<unsigned> line{0};
+  };
+  struct _ring
+  {
+    _slot slots[SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE];
+    std::atomic<unsigned long long> written{0};
+    std::atomic<bool> in_use{true};
+    size_t index{0};
+    _ring *next{nullptr};  // immutable once published
+  };
+  // Trivially destructible, so it remains usable during the destruction of other thread locals
+  struct _thread_state
+  {
+    _ring *ring;
+    bool closed;
+  };
+  struct _reaper
+  {
+    ~_reaper()
+    {
+      _thread_state &t = _state();
+      t.closed = true;
+      if(t.ring != nullptr)
+      {
+        t.ring->in_use.store(false, std::memory_order_release);
+        t.ring = nullptr;
+      }
+    }
+  };
+
+  // Constant initialised, so safe to use from a signal handler
+  static std::atomic<_ring *> &_rings() noexcept
+  {
+    static std::atomic<_ring *> v{nullptr};
+    return v;
+  }
+  static _thread_state &_state() noexcept
+  {
+    static thread_local _thread_state v;
+    return v;
+  }
+  static _ring *_acquire_ring() noexcept
+  {
+    _thread_state &t = _state();
+    if(t.closed)
+    {
+      return nullptr;
+    }
+    // Reuse the ring of an exited thread if possible
+    _ring *ring = nullptr;
+    for(_ring *r = _rings().load(std::memory_order_acquire); r != nullptr; r = r->next)
+    {
+      bool expected = false;
+      if(!r->in_use.load(std::memory_order_relaxed) &&
+         r->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire, std::memory_order_relaxed))
+      {
+        ring = r;
+        break;
+      }
+    }
+    if(ring == nullptr)
+    {
+      ring = new(std::nothrow) _ring;
+      if(ring == nullptr)
+      {
+        return nullptr;
+      }
+      ring->next = _rings().load(std::memory_order_relaxed);
+      do
+      {
+        ring->index = (ring->next != nullptr) ? ring->next->index + 1 : 0;
+      } while(!_rings().compare_exchange_weak(ring->next, ring, std::memory_order_release, std::memory_order_relaxed));
+    }
+    static thread_local _reaper r;
+    (void) r;
+    t.ring = ring;
+    return ring;
+  }
+
+  template <class T> static char *_format_decimal(char *p, char *end, T v) noexcept
+  {
+    char digits[24];
+    size_t n = 0;
+    const bool negative = v < 0;
+    auto u = negative ? (0ULL - static_cast<unsigned long long>(v)) : static_cast<unsigned long long>(v);
+    do
+    {
+      digits[n++] = static_cast<char>('0' + (u % 10));
+      u /= 10;
+    } while(u != 0);
+    if(negative && p != end)
+    {
+      *p++ = '-';
+    }
+    while(n > 0 && p != end)
+    {
+      *p++ = digits[--n];
+    }
+    return p;
+  }
+  static char *_format_hex(char *p, char *end, unsigned long long v) noexcept
+  {
+    static constexpr const char hex[] = "0123456789abcdef";
+    for(int shift = 60; shift >= 0 && p != end; shift -= 4)
+    {
+      *p++ = hex[(v >> static_cast<unsigned>(shift)) & 15U];
+    }
+    return p;
+  }
+  static char *_format_string(char *p, char *end, const char *s) noexcept
+  {
+    while(*s != 0 && p != end)
+    {
+      *p++ = *s++;
+    }
+    return p;
+  }
+  // Formats one line of text for `rec` of ring `ring`, returning the end of the text written
+  static char *_format(char *p, char *end, size_t ring, const flight_recorder_record &rec) noexcept
+  {
+    p = _format_string(p, end, "thread ");
+    p = _format_decimal(p, end, ring);
+    p = _format_string(p, end, " #");
+    p = _format_decimal(p, end, rec.sequence);
+    p = _format_string(p, end, " time ");
+    p = _format_decimal(p, end, rec.timestamp);
+    p = _format_string(p, end, " domain ");
+    p = _format_hex(p, end, rec.domain_id);
+    p = _format_string(p, end, " value ");
+    p = _format_decimal(p, end, rec.value);
+    if(rec.file != nullptr)
+    {
+      p = _format_string(p, end, " at ");
+      p = _format_string(p, end, rec.file);
+      p = _format_string(p, end, ":");
+      p = _format_decimal(p, end, rec.line);
+    }
+    return _format_string(p, end, "\n");
+  }
+
+public:
+  /*! Obtains a ring for the calling thread if it does not yet have one, so that
+  recording never allocates. Returns false if memory could not be allocated.
+  */
+  static bool thread_init() noexcept { return _state().ring != nullptr || _acquire_ring() != nullptr; }
+
+  //! Records `code` if it is not empty, with the optional source location `file` and `line`.
+  static void record(const status_code<void> &code, const char *file = nullptr, unsigned line = 0) noexcept
+  {
+    if(code.empty())
+    {
+      return;
+    }
+    _ring *ring = _state().ring;
+    if(ring == nullptr)
+    {
+      ring = _acquire_ring();
+      if(ring == nullptr)
+      {
+        return;
+      }
+    }
+    const status_code_domain &domain = code.domain();
+    long long value = 0;
+    (void) detail::status_code_domain_access::load_integral_value(domain, value, code);
+    const long long timestamp = SYSTEM_ERROR2_FLIGHT_RECORDER_TIMESTAMP();
+
+    const unsigned long long seq = ring->written.load(std::memory_order_relaxed);
+    _slot &s = ring->slots[seq & (SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE - 1)];
+    s.seq.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    s.domain_id.store(domain.id(), std::memory_order_relaxed);
+    s.value.store(value, std::memory_order_relaxed);
+    s.timestamp.store(timestamp, std::memory_order_relaxed);
+    s.file.store(file, std::memory_order_relaxed);
+    s.line.store(line, std::memory_order_relaxed);
+    s.seq.store(seq + 1, std::memory_order_release);
+    ring->written.store(seq + 1, std::memory_order_release);
+  }
+
+  /*! Calls `f(size_t ring, const flight_recorder_record &)` for every recorded error
+  of every thread, oldest first within each ring. Rings are numbered from zero in
+  order of creation. Async signal safe if `f` is.
+  */
+  template <class F> static void for_each(F &&f) noexcept(noexcept(f(static_cast<size_t>(0), flight_recorder_record{})))
+  {
+    for(const _ring *r = _rings().load(std::memory_order_acquire); r != nullptr; r = r->next)
+    {
+      const unsigned long long written = r->written.load(std::memory_order_acquire);
+      const unsigned long long first =
+      (written > SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE) ? (written - SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE) : 0;
+      for(unsigned long long seq = first; seq < written; seq++)
+      {
+        const _slot &s = r->slots[seq & (SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE - 1)];
+        if(s.seq.load(std::memory_order_acquire) != seq + 1)
+        {
+          continue;
+        }
+        flight_recorder_record rec{seq,
+                                   s.domain_id.load(std::memory_order_relaxed),
+                                   s.value.load(std::memory_order_relaxed),
+                                   s.timestamp.load(std::memory_order_relaxed),
+                                   s.file.load(std::memory_order_relaxed),
+                                   s.line.load(std::memory_order_relaxed)};
+        std::atomic_thread_fence(std::memory_order_acquire);
+        // Skip records overwritten whilst being read
+        if(s.seq.load(std::memory_order_relaxed) != seq + 1)
+        {
+          continue;
+        }
+        f(r->index, rec);
+      }
+    }
+  }
+
+  /*! Writes a line of text per recorded error of every thread into `buffer`, returning
+  the number of characters written. The text is truncated if `bytes` is too small,
+  and is not null terminated. Async signal safe.
+  */
+  static size_t dump(char *buffer, size_t bytes) noexcept
+  {
+    char *p = buffer, *const end = buffer + bytes;
+    for_each([&](size_t ring, const flight_recorder_record &rec) noexcept { p = _format(p, end, ring, rec); });
+    return static_cast<size_t>(p - buffer);
+  }
+#ifndef _WIN32
+  /*! Writes a line of text per recorded error of every thread to the file descriptor
+  `fd`. Returns false if a write failed. Async signal safe.
+  */
+  static bool dump(int fd) noexcept
+  {
+    bool ok = true;
+    for_each([&](size_t ring, const flight_recorder_record &rec) noexcept {
+      char line[512];
+      const char *p = line, *const end = _format(line, line + sizeof(line), ring, rec);
+      while(ok && p != end)
+      {
+        const ssize_t written = ::write(fd, p, static_cast<size_t>(end - p));
+        if(written < 0)
+        {
+          ok = (errno == EINTR);
+          continue;
+        }
+        p += written;
+      }
+    });
+    return ok;
+  }
+#endif
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,75 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#ifndef SYSTEM_ERROR2_FMT_SUPPORT_HPP
+#define SYSTEM_ERROR2_FMT_SUPPORT_HPP
+
+#include "format_support.hpp"
+
+#include <fmt/format.h>
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+namespace detail
+{
+  struct fmt_format_to
+  {
+    template <class OutputIt, class T> OutputIt operator()(OutputIt out, const T &v) const
+    {
+      return fmt::format_to(out, "{}", v);
+    }
+  };
+}  // namespace detail
+SYSTEM_ERROR2_NAMESPACE_END
+
+namespace fmt
+{
+  //! Formats a status code by fmt. The format spec may be empty, `n` for the domain's name, `v` for the value,
+  //! `x` for the value in hexadecimal or `m` for the message. Nothing is allocated from the heap.
+  template <class DomainType>
+  struct formatter<SYSTEM_ERROR2_NAMESPACE::status_code<DomainType>, char>
+      : SYSTEM_ERROR2_NAMESPACE::detail::status_code_formatter<fmt::format_error, fmt::string_view,
+                                                             fmt::formatter<fmt::string_view, char>>
+  {
+  };
+  //! Formats an errored status code by fmt, as for `status_code`.
+  template <class DomainType>
+  struct formatter<SYSTEM_ERROR2_NAMESPACE::errored_status_code<DomainType>, char>
+      : SYSTEM_ERROR2_NAMESPACE::detail::status_code_formatter<fmt::format_error, fmt::string_view,
+                                                             fmt::formatter<fmt::string_view, char>>
+  {
+  };
+#if __cplusplus >= 201703L || _HAS_CXX17
+  //! Formats a result by fmt, its error as for `status_code` and its value by its own formatter.
+  template <class T>
+  struct formatter<SYSTEM_ERROR2_NAMESPACE::result<T>, char>
+      : SYSTEM_ERROR2_NAMESPACE::detail::result_formatter<T, fmt::format_error, fmt::string_view,
+                                                          fmt::formatter<fmt::string_view, char>,
+                                                          SYSTEM_ERROR2_NAMESPACE::detail::fmt_format_to>
+  {
+  };
+#endif
+}  // namespace fmt
+
+#endif
@@ -0,0 +1,268 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#ifndef SYSTEM_ERROR2_FORMAT_SUPPORT_HPP
+#define SYSTEM_ERROR2_FORMAT_SUPPORT_HPP
+
+#include "error.hpp"
+#include "result.hpp"
+
+#if defined(__has_include)
+#if __has_include(<format>) && (__cplusplus >= 202002L || _HAS_CXX20)
+#include <format>
+#endif
+#endif
+
+//! The size of the stack buffer into which the formatters render a code. Longer renderings are truncated.
+#ifndef SYSTEM_ERROR2_FORMAT_BUFFER_SIZE
+#define SYSTEM_ERROR2_FORMAT_BUFFER_SIZE 256
+#endif
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  /* Renders status codes into buffers without allocating memory, for the formatters of
+  `std::format` and fmt. The format spec is empty or one of:
+
+  - `n`: the name of the domain.
+  - `v`: the value in decimal.
+  - `x`: the value in lower case hexadecimal, as wide as the value of the domain.
+  - `m`: the message, by `message_into()`.
+
+  An empty spec writes the name and the message, as `operator<<` prints an erased code.
+  An empty code is always written as `(empty)`, and the value of a code whose domain
+  does not describe an integral value as `(opaque)`.
+  */
+  struct format_status_code
+  {
+    // Parses the format spec beginning at it, returning its end
+    template <class Iterator>
+    static SYSTEM_ERROR2_CONSTEXPR14 Iterator parse(char &kind, bool &valid, Iterator it, Iterator end) noexcept
+    {
+      kind = 0;
+      valid = true;
+      if(it != end && *it != '}')
+      {
+        kind = *it++;
+        valid = (kind == 'n' || kind == 'v' || kind == 'x' || kind == 'm');
+      }
+      if(it != end && *it != '}')
+      {
+        valid = false;
+      }
+      return it;
+    }
+
+    // Copies as much of a string as fits into the buffer, returning the characters copied
+    static size_t put(char *buffer, size_t length, const char *str, size_t len) noexcept
+    {
+      if(len > length)
+      {
+        len = length;
+      }
+      memcpy(buffer, str, len);
+      return len;
+    }
+
+    // Renders the value of the code into the buffer, returning the characters rendered
+    static size_t render_value(char *buffer, size_t length, const status_code<void> &code, bool hex) noexcept
+    {
+      long long v = 0;
+      if(!status_code_domain_access::load_integral_value(code.domain(), v, code))
+      {
+        return put(buffer, length, "(opaque)", 8);
+      }
+      const auto &info = code.domain().value_info();
+      char digits[24];
+      char *const e = digits + sizeof(digits);
+      char *p = e;
+      auto u = static_cast<unsigned long long>(v);
+      if(hex)
+      {
+        if(info.size < sizeof(u))
+        {
+          u &= (1ULL << (8 * info.size)) - 1;
+        }
+        do
+        {
+          *--p = "0123456789abcdef"[u & 15];
+          u >>= 4;
+        } while(u != 0);
+      }
+      else
+      {
+        const bool negative = info.is_signed && v < 0;
+        if(negative)
+        {
+          u = 0 - u;
+        }
+        do
+        {
+          *--p = static_cast<char>('0' + (u % 10));
+          u /= 10;
+        } while(u != 0);
+        if(negative)
+        {
+          *--p = '-';
+        }
+      }
+      return put(buffer, length, p, static_cast<size_t>(e - p));
+    }
+
+    // Renders the code as the format spec says into the buffer, returning the characters rendered
+    static size_t render(char *buffer, size_t length, const status_code<void> &code, char kind) noexcept
+    {
+      if(code.empty())
+      {
+        return put(buffer, length, "(empty)", 7);
+      }
+      if(kind == 'v' || kind == 'x')
+      {
+        return render_value(buffer, length, code, kind == 'x');
+      }
+      size_t ret = 0;
+      if(kind != 'm')
+      {
+        // Names are string literals or kept by the domain, so this string_ref never allocates
+        const auto name = code.domain().name();
+        ret = put(buffer, length, name.data(), name.size());
+        if(kind == 'n')
+        {
+          return ret;
+        }
+        ret += put(buffer + ret, length - ret, ": ", 2);
+      }
+      // message_into() null terminates, so give it the byte beyond the buffer
+      return ret + code.message_into(buffer + ret, length - ret + 1);
+    }
+  };
+
+  /* The formatter of status codes for `std::format` and fmt, which report an invalid format
+  spec by `FormatError`. A code is rendered into a stack buffer, then written in one go by
+  the library's `StringFormatter`, as writing a character at a time through the output
+  iterator is several times slower.
+  */
+  template <class FormatError, class StringView, class StringFormatter> struct status_code_formatter
+  {
+    char _kind{0};
+    StringFormatter _string;
+
+    template <class ParseContext> SYSTEM_ERROR2_CONSTEXPR14 auto parse(ParseContext &ctx) -> decltype(ctx.begin())
+    {
+      bool valid = true;
+      auto it = format_status_code::parse(_kind, valid, ctx.begin(), ctx.end());
+      if(!valid)
+      {
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
+        throw FormatError("the format spec of a status code must be empty or one of n, v, x or m");
+#else
+        SYSTEM_ERROR2_FATAL("the format spec of a status code must be empty or one of n, v, x or m");
+#endif
+      }
+      return it;
+    }
+    template <class FormatContext>
+    auto format(const status_code<void> &code, FormatContext &ctx) const -> decltype(ctx.out())
+    {
+      char buffer[SYSTEM_ERROR2_FORMAT_BUFFER_SIZE + 1];
+      const size_t len = format_status_code::render(buffer, sizeof(buffer) - 1, code, _kind);
+      return _string.format(StringView(buffer, len), ctx);
+    }
+  };
+
+#if __cplusplus >= 201703L || _HAS_CXX17
+  /* The formatter of results for `std::format` and fmt. The format spec applies to an error,
+  a value is formatted with an empty format spec by `FormatTo`.
+  */
+  template <class T, class FormatError, class StringView, class StringFormatter, class FormatTo>
+  struct result_formatter : status_code_formatter<FormatError, StringView, StringFormatter>
+  {
+    using _base = status_code_formatter<FormatError, StringView, StringFormatter>;
+
+    template <class FormatContext> auto format(const result<T> &r, FormatContext &ctx) const -> decltype(ctx.out())
+    {
+      if(r.has_error())
+      {
+        return _base::format(r.assume_error(), ctx);
+      }
+      if constexpr(std::is_void_v<T>)
+      {
+        return this->_string.format(StringView("success", 7), ctx);
+      }
+      else
+      {
+        return FormatTo()(ctx.out(), r.assume_value());
+      }
+    }
+  };
+#endif
+}  // namespace detail
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#if defined(__cpp_lib_format) || defined(STANDARDESE_IS_IN_THE_HOUSE)
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+namespace detail
+{
+  struct std_format_to
+  {
+    template <class OutputIt, class T> OutputIt operator()(OutputIt out, const T &v) const
+    {
+      return std::format_to(out, "{}", v);
+    }
+  };
+}  // namespace detail
+SYSTEM_ERROR2_NAMESPACE_END
+
+namespace std
+{
+  //! Formats a status code by `std::format`. The format spec may be empty, `n` for the domain's name, `v` for the
+  //! value, `x` for the value in hexadecimal or `m` for the message. Nothing is allocated from the heap.
+  template <class DomainType>
+  struct formatter<SYSTEM_ERROR2_NAMESPACE::status_code<DomainType>, char>
+      : SYSTEM_ERROR2_NAMESPACE::detail::status_code_formatter<std::format_error, std::string_view,
+                                                             std::formatter<std::string_view, char>>
+  {
+  };
+  //! Formats an errored status code by `std::format`, as for `status_code`.
+  template <class DomainType>
+  struct formatter<SYSTEM_ERROR2_NAMESPACE::errored_status_code<DomainType>, char>
+      : SYSTEM_ERROR2_NAMESPACE::detail::status_code_formatter<std::format_error, std::string_view,
+                                                             std::formatter<std::string_view, char>>
+  {
+  };
+  //! Formats a result by `std::format`, its error as for `status_code` and its value by its own formatter.
+  template <class T>
+  struct formatter<SYSTEM_ERROR2_NAMESPACE::result<T>, char>
+      : SYSTEM_ERROR2_NAMESPACE::detail::result_formatter<T, std::format_error, std::string_view,
+                                                          std::formatter<std::string_view, char>,
+                                                          SYSTEM_ERROR2_NAMESPACE::detail::std_format_to>
+  {
+  };
+}  // namespace std
+#endif
+
+#endif
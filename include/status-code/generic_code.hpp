@@ -306,9 +306,21 @@ public:
   using string_ref = _base::string_ref;
 
 public:
+  //! Describes this domain's values, see `status_code_domain::value_info_t`
+  static constexpr value_info_t _default_value_info() noexcept
+  {
+    return _make_value_info<value_type>(value_info_t::failure_kind::nonzero).with_generic_code_identity();
+  }
   //! Default constructor
   constexpr explicit _generic_code_domain(typename _base::unique_id_type id = 0x746d6354f4f733e9) noexcept
-      : _base(id)
+      : _base(id, _own_value_info(id, 0x746d6354f4f733e9, _default_value_info()))
+  {
+  }
+  /*! Constructor for a domain derived from this one, which by passing `value_info` opts into
+  `failure()` and `equivalent()` being determined from it where possible.
+  */
+  constexpr _generic_code_domain(typename _base::unique_id_type id, value_info_t value_info) noexcept
+      : _base(id, value_info)
   {
   }
   _generic_code_domain(const _generic_code_domain &) = default;
@@ -424,6 +436,18 @@ _generic_code_domain::_do_generic_code(_vtable_generic_code_args &args) const no
 SYSTEM_ERROR2_CONSTEXPR20 inline generic_code
 status_code_domain::_generic_code(const status_code<void> &code) const noexcept
 {
+  long long v = 0;
+  if(_value_info.generic_size != 0 && !detail::is_constant_evaluated() && _load_integral_value(v, code))
+  {
+    // One comparison tests both ends of the range
+    const unsigned long long idx =
+    static_cast<unsigned long long>(v) - static_cast<unsigned long long>(_value_info.generic_first);
+    if(idx < _value_info.generic_size)
+    {
+      const errc *table = _value_info.generic_table;
+      return generic_code(in_place, (table != nullptr) ? table[idx] : static_cast<errc>(v));
+    }
+  }
   _vtable_generic_code_args args{{}, code};
   _do_generic_code(args);
   return args.ret;
@@ -460,19 +484,139 @@ inline SYSTEM_ERROR2_CONSTEXPR14 bool status_code<void>::equivalent(const status
   // If we are both empty, we are equivalent, otherwise not equivalent
   return (!_domain && !o._domain);
 }
-//! True if the status code's are semantically equal via `equivalent()`.
+
+#ifndef SYSTEM_ERROR2_EQUIVALENCE_CACHE_SIZE
+//! The number of entries in each thread's `status_code<void>::cached_equivalent()` cache. Must be a power of two.
+#define SYSTEM_ERROR2_EQUIVALENCE_CACHE_SIZE 64
+#endif
+
+namespace detail
+{
+  /* A direct mapped cache of equivalence results. Being thread local, it needs
+  no synchronisation, and being trivially constructible, it needs no guard on
+  first use. A domain id of zero is never valid, so marks an empty entry.
+  */
+  struct equivalence_cache
+  {
+    static_assert((SYSTEM_ERROR2_EQUIVALENCE_CACHE_SIZE & (SYSTEM_ERROR2_EQUIVALENCE_CACHE_SIZE - 1)) == 0,
+                  "SYSTEM_ERROR2_EQUIVALENCE_CACHE_SIZE must be a power of two");
+
+    struct entry
+    {
+      unsigned long long id1, id2;
+      long long value1, value2;
+      bool result;
+    } entries[SYSTEM_ERROR2_EQUIVALENCE_CACHE_SIZE];
+
+    static equivalence_cache &get() noexcept
+    {
+      static thread_local equivalence_cache v;
+      return v;
+    }
+    static size_t index(unsigned long long id1, long long value1, unsigned long long id2, long long value2) noexcept
+    {
+      unsigned long long x = id1 ^ (id2 * 0x9e3779b97f4a7c15ULL);
+      x ^= static_cast<unsigned long long>(value1) * 0xff51afd7ed558ccdULL;
+      x ^= static_cast<unsigned long long>(value2) * 0xc4ceb9fe1a85ec53ULL;
+      // Finaliser from MurmurHash3
+      x ^= x >> 33U;
+      x *= 0xff51afd7ed558ccdULL;
+      x ^= x >> 33U;
+      return static_cast<size_t>(x) & (SYSTEM_ERROR2_EQUIVALENCE_CACHE_SIZE - 1);
+    }
+  };
+}  // namespace detail
+
+template <class T> inline bool status_code<void>::cached_equivalent(const status_code<T> &o) const noexcept
+{
+  long long value1 = 0, value2 = 0;
+  if(!_domain || !o._domain || !_domain->_load_integral_value(value1, *this) ||
+     !o._domain->_load_integral_value(value2, o))
+  {
+    return equivalent(o);
+  }
+  const unsigned long long id1 = _domain->id(), id2 = o._domain->id();
+  auto &e = detail::equivalence_cache::get().entries[detail::equivalence_cache::index(id1, value1, id2, value2)];
+  if(e.id1 == id1 && e.id2 == id2 && e.value1 == value1 && e.value2 == value2)
+  {
+    return e.result;
+  }
+  const bool result = equivalent(o);
+  e.id1 = id1;
+  e.id2 = id2;
+  e.value1 = value1;
+  e.value2 = value2;
+  e.result = result;
+  return result;
+}
+
+namespace traits
+{
+  //! Generic codes are equivalent if their values are equal.
+  template <> struct static_equivalence<_generic_code_domain, _generic_code_domain>
+  {
+    static constexpr bool value = true;
+    static constexpr bool equivalent(const generic_code &a, const generic_code &b) noexcept
+    {
+      return a.value() == b.value();
+    }
+  };
+}  // namespace traits
+
+namespace detail
+{
+  // Compares by `traits::static_equivalence` in whichever order of domains is specialised, else by `equivalent()`
+  template <class DomainType1, class DomainType2,
+            int Order = traits::static_equivalence<DomainType1, DomainType2>::value ?
+                        1 :
+                        (traits::static_equivalence<DomainType2, DomainType1>::value ? 2 : 0)>
+  struct equivalence_dispatch
+  {
+    static SYSTEM_ERROR2_CONSTEXPR14 bool equivalent(const status_code<DomainType1> &a,
+                                                     const status_code<DomainType2> &b) noexcept
+    {
+      return a.equivalent(b);
+    }
+  };
+  template <class DomainType1, class DomainType2> struct equivalence_dispatch<DomainType1, DomainType2, 1>
+  {
+    static constexpr bool equivalent(const status_code<DomainType1> &a, const status_code<DomainType2> &b) noexcept
+    {
+      return (a.empty() || b.empty()) ? (a.empty() && b.empty()) :
+                                        traits::static_equivalence<DomainType1, DomainType2>::equivalent(a, b);
+    }
+  };
+  template <class DomainType1, class DomainType2> struct equivalence_dispatch<DomainType1, DomainType2, 2>
+  {
+    static constexpr bool equivalent(const status_code<DomainType1> &a, const status_code<DomainType2> &b) noexcept
+    {
+      return (a.empty() || b.empty()) ? (a.empty() && b.empty()) :
+                                        traits::static_equivalence<DomainType2, DomainType1>::equivalent(b, a);
+    }
+  };
+  template <class DomainType1, class DomainType2>
+  SYSTEM_ERROR2_CONSTEXPR14 inline bool dispatch_equivalent(const status_code<DomainType1> &a,
+                                                            const status_code<DomainType2> &b) noexcept
+  {
+    return equivalence_dispatch<DomainType1, DomainType2>::equivalent(a, b);
+  }
+}  // namespace detail
+
+//! True if the status code's are semantically equal via `equivalent()`, or `traits::static_equivalence` if
+//! specialised for their domains.
 template <class DomainType1, class DomainType2>
 SYSTEM_ERROR2_CONSTEXPR14 inline bool operator==(const status_code<DomainType1> &a,
                                                  const status_code<DomainType2> &b) noexcept
 {
-  return a.equivalent(b);
+  return detail::dispatch_equivalent(a, b);
 }
-//! True if the status code's are not semantically equal via `equivalent()`.
+//! True if the status code's are not semantically equal via `equivalent()`, or `traits::static_equivalence` if
+//! specialised for their domains.
 template <class DomainType1, class DomainType2>
 SYSTEM_ERROR2_CONSTEXPR14 inline bool operator!=(const status_code<DomainType1> &a,
                                                  const status_code<DomainType2> &b) noexcept
 {
-  return !a.equivalent(b);
+  return !detail::dispatch_equivalent(a, b);
 }
 //! True if the status code's are semantically equal via `equivalent()` to `make_status_code(T)`.
 SYSTEM_ERROR2_TEMPLATE(class DomainType1, class T,  //
@@ -481,7 +625,7 @@ SYSTEM_ERROR2_TEMPLATE(class DomainType1, class T,  //
 SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(is_status_code<MakeStatusCodeResult>::value))  // ADL makes a status code
 SYSTEM_ERROR2_CONSTEXPR14 inline bool operator==(const status_code<DomainType1> &a, const T &b)
 {
-  return a.equivalent(make_status_code(b));
+  return detail::dispatch_equivalent(a, make_status_code(b));
 }
 //! True if the status code's are semantically equal via `equivalent()` to `make_status_code(T)`.
 SYSTEM_ERROR2_TEMPLATE(class T, class DomainType1,  //
@@ -490,7 +634,7 @@ SYSTEM_ERROR2_TEMPLATE(class T, class DomainType1,  //
 SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(is_status_code<MakeStatusCodeResult>::value))  // ADL makes a status code
 SYSTEM_ERROR2_CONSTEXPR14 inline bool operator==(const T &a, const status_code<DomainType1> &b)
 {
-  return b.equivalent(make_status_code(a));
+  return detail::dispatch_equivalent(b, make_status_code(a));
 }
 //! True if the status code's are not semantically equal via `equivalent()` to `make_status_code(T)`.
 SYSTEM_ERROR2_TEMPLATE(class DomainType1, class T,  //
@@ -499,7 +643,7 @@ SYSTEM_ERROR2_TEMPLATE(class DomainType1, class T,  //
 SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(is_status_code<MakeStatusCodeResult>::value))  // ADL makes a status code
 SYSTEM_ERROR2_CONSTEXPR14 inline bool operator!=(const status_code<DomainType1> &a, const T &b)
 {
-  return !a.equivalent(make_status_code(b));
+  return !detail::dispatch_equivalent(a, make_status_code(b));
 }
 //! True if the status code's are semantically equal via `equivalent()` to `make_status_code(T)`.
 SYSTEM_ERROR2_TEMPLATE(class T, class DomainType1,  //
@@ -508,7 +652,7 @@ SYSTEM_ERROR2_TEMPLATE(class T, class DomainType1,  //
 SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(is_status_code<MakeStatusCodeResult>::value))  // ADL makes a status code
 SYSTEM_ERROR2_CONSTEXPR14 inline bool operator!=(const T &a, const status_code<DomainType1> &b)
 {
-  return !b.equivalent(make_status_code(a));
+  return !detail::dispatch_equivalent(b, make_status_code(a));
 }
 //! True if the status code's are semantically equal via `equivalent()` to
 //! `quick_status_code_from_enum<T>::code_type(b)`.
@@ -43,6 +43,94 @@ using getaddrinfo_code = status_code<_getaddrinfo_code_domain>;
 //! A specialisation of `status_error` for the `getaddrinfo()` error code domain.
 using getaddrinfo_error = status_error<_getaddrinfo_code_domain>;
 
+namespace detail
+{
+  // The generic code of each `getaddrinfo()` code
+  SYSTEM_ERROR2_CONSTEXPR14 inline errc getaddrinfo_generic_code(int value) noexcept
+  {
+    switch(value)
+    {
+#ifdef EAI_ADDRFAMILY
+    case EAI_ADDRFAMILY:
+      return errc::no_such_device_or_address;
+#endif
+    case EAI_FAIL:
+      return errc::io_error;
+    case EAI_MEMORY:
+      return errc::not_enough_memory;
+#ifdef EAI_NODATA
+    case EAI_NODATA:
+      return errc::no_such_device_or_address;
+#endif
+    case EAI_NONAME:
+      return errc::no_such_device_or_address;
+#ifdef EAI_OVERFLOW
+    case EAI_OVERFLOW:
+      return errc::argument_list_too_long;
+#endif
+    case EAI_BADFLAGS:  // fallthrough
+    case EAI_SERVICE:
+      return errc::invalid_argument;
+    case EAI_FAMILY:  // fallthrough
+    case EAI_SOCKTYPE:
+      return errc::operation_not_supported;
+    case EAI_AGAIN:  // fallthrough
+    case EAI_SYSTEM:
+      return errc::resource_unavailable_try_again;
+    default:
+      return errc::unknown;
+    }
+  }
+
+#if __cplusplus >= 201400 || _MSC_VER >= 1910 /* VS2017 */
+  // The `getaddrinfo()` codes with a generic code, whose values vary by platform
+  constexpr int getaddrinfo_mapped_codes[] = {
+  EAI_FAIL, EAI_MEMORY, EAI_NONAME, EAI_BADFLAGS, EAI_SERVICE, EAI_FAMILY, EAI_SOCKTYPE, EAI_AGAIN, EAI_SYSTEM,
+#ifdef EAI_ADDRFAMILY
+  EAI_ADDRFAMILY,
+#endif
+#ifdef EAI_NODATA
+  EAI_NODATA,
+#endif
+#ifdef EAI_OVERFLOW
+  EAI_OVERFLOW,
+#endif
+  };
+  constexpr int getaddrinfo_mapped_code_bound(bool upper) noexcept
+  {
+    int ret = getaddrinfo_mapped_codes[0];
+    for(int v : getaddrinfo_mapped_codes)
+    {
+      if(upper ? (v > ret) : (v < ret))
+      {
+        ret = v;
+      }
+    }
+    return ret;
+  }
+  // The generic codes of the range of mapped `getaddrinfo()` codes, so `equivalent()` need not call
+  // `_do_generic_code()`. Empty if the range is implausibly sparse.
+  struct getaddrinfo_generic_code_table
+  {
+    static constexpr int first = getaddrinfo_mapped_code_bound(false);
+    static constexpr int size = (getaddrinfo_mapped_code_bound(true) - first < 256) ?
+                                (getaddrinfo_mapped_code_bound(true) - first + 1) :
+                                0;
+    errc table[(size > 0) ? size : 1];
+  };
+  constexpr getaddrinfo_generic_code_table make_getaddrinfo_generic_code_table() noexcept
+  {
+    getaddrinfo_generic_code_table ret{};
+    for(int n = 0; n < getaddrinfo_generic_code_table::size; n++)
+    {
+      ret.table[n] = getaddrinfo_generic_code(getaddrinfo_generic_code_table::first + n);
+    }
+    return ret;
+  }
+  constexpr getaddrinfo_generic_code_table getaddrinfo_generic_codes = make_getaddrinfo_generic_code_table();
+#endif
+}  // namespace detail
+
 /*! The implementation of the domain for `getaddrinfo()` error codes, those returned by `getaddrinfo()`.
  */
 class _getaddrinfo_code_domain : public status_code_domain
@@ -55,9 +143,27 @@ public:
   using value_type = int;
   using _base::string_ref;
 
+  //! Describes this domain's values, see `status_code_domain::value_info_t`
+  static constexpr value_info_t _default_value_info() noexcept
+  {
+    return _make_value_info<value_type>(value_info_t::failure_kind::nonzero)
+#if __cplusplus >= 201400 || _MSC_VER >= 1910 /* VS2017 */
+        .with_generic_code_table(detail::getaddrinfo_generic_code_table::first,
+                                 detail::getaddrinfo_generic_code_table::size,
+                                 detail::getaddrinfo_generic_codes.table)
+#endif
+        ;
+  }
   //! Default constructor
   constexpr explicit _getaddrinfo_code_domain(typename _base::unique_id_type id = 0x5b24b2de470ff7b6) noexcept
-      : _base(id)
+      : _base(id, _own_value_info(id, 0x5b24b2de470ff7b6, _default_value_info()))
+  {
+  }
+  /*! Constructor for a domain derived from this one, which by passing `value_info` opts into
+  `failure()` and `equivalent()` being determined from it where possible.
+  */
+  constexpr _getaddrinfo_code_domain(typename _base::unique_id_type id, value_info_t value_info) noexcept
+      : _base(id, value_info)
   {
   }
   _getaddrinfo_code_domain(const _getaddrinfo_code_domain &) = default;
@@ -103,48 +209,7 @@ protected:
   {
     assert(args.code.domain() == *this);                               // NOLINT
     const auto &c = static_cast<const getaddrinfo_code &>(args.code);  // NOLINT
-    switch(c.value())
-    {
-#ifdef EAI_ADDRFAMILY
-    case EAI_ADDRFAMILY:
-      args.ret = errc::no_such_device_or_address;
-      return;
-#endif
-    case EAI_FAIL:
-      args.ret = errc::io_error;
-      return;
-    case EAI_MEMORY:
-      args.ret = errc::not_enough_memory;
-      return;
-#ifdef EAI_NODATA
-    case EAI_NODATA:
-      args.ret = errc::no_such_device_or_address;
-      return;
-#endif
-    case EAI_NONAME:
-      args.ret = errc::no_such_device_or_address;
-      return;
-#ifdef EAI_OVERFLOW
-    case EAI_OVERFLOW:
-      args.ret = errc::argument_list_too_long;
-      return;
-#endif
-    case EAI_BADFLAGS:  // fallthrough
-    case EAI_SERVICE:
-      args.ret = errc::invalid_argument;
-      return;
-    case EAI_FAMILY:  // fallthrough
-    case EAI_SOCKTYPE:
-      args.ret = errc::operation_not_supported;
-      return;
-    case EAI_AGAIN:  // fallthrough
-    case EAI_SYSTEM:
-      args.ret = errc::resource_unavailable_try_again;
-      return;
-    default:
-      args.ret = errc::unknown;
-      return;
-    }
+    args.ret = detail::getaddrinfo_generic_code(c.value());
   }
   virtual int _do_message(_vtable_message_args &args) const noexcept override
   {
@@ -153,6 +218,14 @@ protected:
     args.ret = string_ref(gai_strerror(c.value()));
     return 0;
   }
+  virtual int _do_message_into(_vtable_message_into_args &args) const noexcept override  // NOLINT
+  {
+    assert(args.code.domain() == *this);                               // NOLINT
+    const auto &c = static_cast<const getaddrinfo_code &>(args.code);  // NOLINT
+    const char *msg = gai_strerror(c.value());
+    args.ret = _copy_string_into(args.buffer, args.length, msg, strlen(msg));
+    return 0;
+  }
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
   SYSTEM_ERROR2_NORETURN virtual void _do_throw_exception(const status_code<void> &code) const override  // NOLINT
   {
@@ -170,6 +243,37 @@ inline constexpr const _getaddrinfo_code_domain &_getaddrinfo_code_domain::get()
   return getaddrinfo_code_domain;
 }
 
+namespace traits
+{
+  //! `getaddrinfo()` codes are equivalent if their values are equal.
+  template <> struct static_equivalence<_getaddrinfo_code_domain, _getaddrinfo_code_domain>
+  {
+    static constexpr bool value = true;
+    static constexpr bool equivalent(const getaddrinfo_code &a, const getaddrinfo_code &b) noexcept
+    {
+      return a.value() == b.value();
+    }
+  };
+  //! A `getaddrinfo()` code is equivalent to the generic code it maps onto.
+  template <> struct static_equivalence<_getaddrinfo_code_domain, _generic_code_domain>
+  {
+    static constexpr bool value = true;
+    static SYSTEM_ERROR2_CONSTEXPR14 bool equivalent(const getaddrinfo_code &a, const generic_code &b) noexcept
+    {
+#if __cplusplus >= 201400 || _MSC_VER >= 1910 /* VS2017 */
+      using table = detail::getaddrinfo_generic_code_table;
+      const auto idx = static_cast<unsigned>(a.value()) - static_cast<unsigned>(table::first);
+      const errc c = (table::size == 0) ? detail::getaddrinfo_generic_code(a.value()) :
+                     (idx < static_cast<unsigned>(table::size)) ? detail::getaddrinfo_generic_codes.table[idx] :
+                                                                  errc::unknown;
+#else
+      const errc c = detail::getaddrinfo_generic_code(a.value());
+#endif
+      return c != errc::unknown && c == b.value();
+    }
+  };
+}  // namespace traits
+
 SYSTEM_ERROR2_NAMESPACE_END
 
 #endif
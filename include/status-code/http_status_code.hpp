@@ -53,6 +53,68 @@ namespace mixins
   };
 }  // namespace mixins
 
+namespace detail
+{
+  // The generic code of each HTTP status code
+  SYSTEM_ERROR2_CONSTEXPR14 inline errc http_status_generic_code(int value) noexcept
+  {
+    switch(value)
+    {
+    case 102:
+    case 202:
+      return errc::operation_in_progress;
+    case 400:
+      return errc::invalid_argument;
+    case 401:
+      return errc::operation_not_permitted;
+    case 403:
+      return errc::permission_denied;
+    case 404:
+    case 410:
+      return errc::no_such_file_or_directory;
+    case 405:
+    case 418:
+      return errc::operation_not_supported;
+    case 406:
+      return errc::protocol_not_supported;
+    case 408:
+      return errc::timed_out;
+    case 413:
+      return errc::result_out_of_range;
+    case 501:
+      return errc::not_supported;
+    case 503:
+      return errc::resource_unavailable_try_again;
+    case 504:
+      return errc::timed_out;
+    case 507:
+      return errc::no_space_on_device;
+    default:
+      return errc::unknown;
+    }
+  }
+
+#if __cplusplus >= 201400 || _MSC_VER >= 1910 /* VS2017 */
+  // The generic codes of HTTP status codes 100 to 599, so `equivalent()` need not call `_do_generic_code()`
+  struct http_status_generic_code_table
+  {
+    static constexpr int first = 100;
+    static constexpr int size = 500;
+    errc table[size];
+  };
+  constexpr http_status_generic_code_table make_http_status_generic_code_table() noexcept
+  {
+    http_status_generic_code_table ret{};
+    for(int n = 0; n < http_status_generic_code_table::size; n++)
+    {
+      ret.table[n] = http_status_generic_code(http_status_generic_code_table::first + n);
+    }
+    return ret;
+  }
+  constexpr http_status_generic_code_table http_status_generic_codes = make_http_status_generic_code_table();
+#endif
+}  // namespace detail
+
 /*! The implementation of the domain for HTTP status codes.
  */
 class _http_status_code_domain : public status_code_domain
@@ -65,9 +127,27 @@ public:
   using value_type = int;
   using _base::string_ref;
 
+  //! Describes this domain's values, see `status_code_domain::value_info_t`
+  static constexpr value_info_t _default_value_info() noexcept
+  {
+    return _make_value_info<value_type>(value_info_t::failure_kind::greater_equal, 400)
+#if __cplusplus >= 201400 || _MSC_VER >= 1910 /* VS2017 */
+        .with_generic_code_table(detail::http_status_generic_code_table::first,
+                                 detail::http_status_generic_code_table::size,
+                                 detail::http_status_generic_codes.table)
+#endif
+        ;
+  }
   //! Default constructor
   constexpr explicit _http_status_code_domain(typename _base::unique_id_type id = 0xbdb4cde88378a333ull) noexcept
-      : _base(id)
+      : _base(id, _own_value_info(id, 0xbdb4cde88378a333ull, _default_value_info()))
+  {
+  }
+  /*! Constructor for a domain derived from this one, which by passing `value_info` opts into
+  `failure()` and `equivalent()` being determined from it where possible.
+  */
+  constexpr _http_status_code_domain(typename _base::unique_id_type id, value_info_t value_info) noexcept
+      : _base(id, value_info)
   {
   }
   _http_status_code_domain(const _http_status_code_domain &) = default;
@@ -116,54 +196,7 @@ protected:
   {
     assert(args.code.domain() == *this);                               // NOLINT
     const auto &c = static_cast<const http_status_code &>(args.code);  // NOLINT
-    switch(c.value())
-    {
-    case 102:
-    case 202:
-      args.ret = errc::operation_in_progress;
-      break;
-    case 400:
-      args.ret = errc::invalid_argument;
-      break;
-    case 401:
-      args.ret = errc::operation_not_permitted;
-      break;
-    case 403:
-      args.ret = errc::permission_denied;
-      break;
-    case 404:
-    case 410:
-      args.ret = errc::no_such_file_or_directory;
-      break;
-    case 405:
-    case 418:
-      args.ret = errc::operation_not_supported;
-      break;
-    case 406:
-      args.ret = errc::protocol_not_supported;
-      break;
-    case 408:
-      args.ret = errc::timed_out;
-      break;
-    case 413:
-      args.ret = errc::result_out_of_range;
-      break;
-    case 501:
-      args.ret = errc::not_supported;
-      break;
-    case 503:
-      args.ret = errc::resource_unavailable_try_again;
-      break;
-    case 504:
-      args.ret = errc::timed_out;
-      break;
-    case 507:
-      args.ret = errc::no_space_on_device;
-      break;
-    default:
-      args.ret = errc::unknown;
-      break;
-    }
+    args.ret = detail::http_status_generic_code(c.value());
   }
   SYSTEM_ERROR2_CONSTEXPR20 virtual int _do_message(_vtable_message_args &args) const noexcept override  // NOLINT
   {
@@ -323,6 +356,36 @@ inline constexpr const _http_status_code_domain &_http_status_code_domain::get()
   return http_status_code_domain;
 }
 
+namespace traits
+{
+  //! HTTP status codes are equivalent if their values are equal.
+  template <> struct static_equivalence<_http_status_code_domain, _http_status_code_domain>
+  {
+    static constexpr bool value = true;
+    static constexpr bool equivalent(const http_status_code &a, const http_status_code &b) noexcept
+    {
+      return a.value() == b.value();
+    }
+  };
+  //! An HTTP status code is equivalent to the generic code it maps onto.
+  template <> struct static_equivalence<_http_status_code_domain, _generic_code_domain>
+  {
+    static constexpr bool value = true;
+    static SYSTEM_ERROR2_CONSTEXPR14 bool equivalent(const http_status_code &a, const generic_code &b) noexcept
+    {
+#if __cplusplus >= 201400 || _MSC_VER >= 1910 /* VS2017 */
+      using table = detail::http_status_generic_code_table;
+      const auto idx = static_cast<unsigned>(a.value()) - static_cast<unsigned>(table::first);
+      const errc c = (idx < static_cast<unsigned>(table::size)) ? detail::http_status_generic_codes.table[idx] :
+                                                                  errc::unknown;
+#else
+      const errc c = detail::http_status_generic_code(a.value());
+#endif
+      return c != errc::unknown && c == b.value();
+    }
+  };
+}  // namespace traits
+
 namespace mixins
 {
   template <class Base> inline bool mixin<Base, _http_status_code_domain>::is_http_informational() const noexcept
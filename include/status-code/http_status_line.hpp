@@ -0,0 +1,250 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_HTTP_STATUS_LINE_HPP
+#define SYSTEM_ERROR2_HTTP_STATUS_LINE_HPP
+
+#include "http_status_code.hpp"
+
+#include <cstdint>
+#include <cstring>  // for memcmp, memcpy, memset
+
+#ifndef SYSTEM_ERROR2_HTTP_STATUS_LINE_SIMD
+#if defined(__AVX2__)
+//! The instructions used to parse HTTP status lines: 2 for AVX2, 1 for SSE2, 0 for portable code.
+#define SYSTEM_ERROR2_HTTP_STATUS_LINE_SIMD 2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SYSTEM_ERROR2_HTTP_STATUS_LINE_SIMD 1
+#else
+#define SYSTEM_ERROR2_HTTP_STATUS_LINE_SIMD 0
+#endif
+#endif
+
+#if SYSTEM_ERROR2_HTTP_STATUS_LINE_SIMD >= 2
+#include <immintrin.h>
+#elif SYSTEM_ERROR2_HTTP_STATUS_LINE_SIMD >= 1
+#include <emmintrin.h>
+#endif
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  // The status code of a `HTTP/1.x NNN` status line, or -1 if it is malformed, checked a byte at a time
+  inline int parse_http_status_line_scalar(const char *line, size_t length) noexcept
+  {
+    auto is_digit = [](char c) { return c >= '0' && c <= '9'; };
+    if(length < 12 || memcmp(line, "HTTP/1.", 7) != 0 || !is_digit(line[7]) || line[8] != ' ' ||
+       !is_digit(line[9]) || !is_digit(line[10]) || !is_digit(line[11]))
+    {
+      return -1;
+    }
+    if(length > 12 && line[12] != ' ' && line[12] != '\r' && line[12] != '\n')
+    {
+      return -1;
+    }
+    return (line[9] - '0') * 100 + (line[10] - '0') * 10 + (line[11] - '0');
+  }
+
+#if SYSTEM_ERROR2_HTTP_STATUS_LINE_SIMD >= 1
+  // The first sixteen bytes of a status line. A shorter line is padded with spaces, so `HTTP/1.1 200` is
+  // accepted and anything shorter is not.
+  inline __m128i http_status_line_load(const char *line, size_t length) noexcept
+  {
+    if(length >= 16)
+    {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i *>(line));  // NOLINT
+    }
+    char buffer[16];
+    memset(buffer, ' ', sizeof(buffer));
+    memcpy(buffer, line, length);
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(buffer));  // NOLINT
+  }
+
+  // Each of the first thirteen bytes of a status line must lie between its bytes in the lower and upper bounds,
+  // except that the byte after the status code may also be a carriage return or line feed. The other bytes of
+  // those two are ones already within bounds, so they accept nothing more.
+  inline __m128i http_status_line_lower_bounds() noexcept
+  {
+    return _mm_setr_epi8('H', 'T', 'T', 'P', '/', '1', '.', '0', ' ', '0', '0', '0', ' ', 0, 0, 0);
+  }
+  inline __m128i http_status_line_upper_bounds() noexcept
+  {
+    return _mm_setr_epi8('H', 'T', 'T', 'P', '/', '1', '.', '9', ' ', '9', '9', '9', ' ', -1, -1, -1);
+  }
+  inline __m128i http_status_line_carriage_returns() noexcept
+  {
+    return _mm_setr_epi8('H', 'T', 'T', 'P', '/', '1', '.', '0', ' ', '0', '0', '0', '\r', 0, 0, 0);
+  }
+  inline __m128i http_status_line_line_feeds() noexcept
+  {
+    return _mm_setr_epi8('H', 'T', 'T', 'P', '/', '1', '.', '0', ' ', '0', '0', '0', '\n', 0, 0, 0);
+  }
+  // All thirteen bits are set in the mask of a well formed line
+  constexpr unsigned http_status_line_bits = 0x1fffU;
+
+  // Bit n is set if byte n of the block is acceptable in a status line
+  inline unsigned http_status_line_mask(__m128i block) noexcept
+  {
+    const __m128i clamped =
+    _mm_min_epu8(_mm_max_epu8(block, http_status_line_lower_bounds()), http_status_line_upper_bounds());
+    const __m128i ok = _mm_or_si128(_mm_cmpeq_epi8(clamped, block),
+                                    _mm_or_si128(_mm_cmpeq_epi8(block, http_status_line_carriage_returns()),
+                                                 _mm_cmpeq_epi8(block, http_status_line_line_feeds())));
+    return static_cast<unsigned>(_mm_movemask_epi8(ok));
+  }
+
+  // The status code of a `HTTP/1.x NNN` status line, or -1 if it is malformed, checked sixteen bytes at a time
+  inline int parse_http_status_line_sse2(const char *line, size_t length) noexcept
+  {
+    if((http_status_line_mask(http_status_line_load(line, length)) & http_status_line_bits) != http_status_line_bits)
+    {
+      return -1;
+    }
+    return (line[9] - '0') * 100 + (line[10] - '0') * 10 + (line[11] - '0');
+  }
+#endif
+
+#if SYSTEM_ERROR2_HTTP_STATUS_LINE_SIMD >= 2
+  // As `http_status_line_mask()`, for two blocks at once with the second in the upper sixteen bits
+  inline unsigned http_status_line_mask(__m256i blocks) noexcept
+  {
+    const __m256i lower = _mm256_broadcastsi128_si256(http_status_line_lower_bounds());
+    const __m256i upper = _mm256_broadcastsi128_si256(http_status_line_upper_bounds());
+    const __m256i clamped = _mm256_min_epu8(_mm256_max_epu8(blocks, lower), upper);
+    const __m256i ok = _mm256_or_si256(
+    _mm256_cmpeq_epi8(clamped, blocks),
+    _mm256_or_si256(_mm256_cmpeq_epi8(blocks, _mm256_broadcastsi128_si256(http_status_line_carriage_returns())),
+                    _mm256_cmpeq_epi8(blocks, _mm256_broadcastsi128_si256(http_status_line_line_feeds()))));
+    return static_cast<unsigned>(_mm256_movemask_epi8(ok));
+  }
+
+  // The status codes of two status lines, or -1 for those which are malformed, checked together
+  inline void parse_http_status_line_pair_avx2(int *values, const char *line0, size_t length0, const char *line1,
+                                               size_t length1) noexcept
+  {
+    const unsigned mask = http_status_line_mask(_mm256_inserti128_si256(
+    _mm256_castsi128_si256(http_status_line_load(line0, length0)), http_status_line_load(line1, length1), 1));
+    values[0] = ((mask & http_status_line_bits) == http_status_line_bits) ?
+                (line0[9] - '0') * 100 + (line0[10] - '0') * 10 + (line0[11] - '0') :
+                -1;
+    values[1] = (((mask >> 16U) & http_status_line_bits) == http_status_line_bits) ?
+                (line1[9] - '0') * 100 + (line1[10] - '0') * 10 + (line1[11] - '0') :
+                -1;
+  }
+#endif
+
+  // The status code of a `HTTP/1.x NNN` status line, or -1 if it is malformed
+  inline int parse_http_status_line(const char *line, size_t length) noexcept
+  {
+#if SYSTEM_ERROR2_HTTP_STATUS_LINE_SIMD >= 1
+    return parse_http_status_line_sse2(line, length);
+#else
+    return parse_http_status_line_scalar(line, length);
+#endif
+  }
+
+  // Stores the code for a parsed value, shifting whether it is a 5xx code into the top of `server_errors`.
+  // Returns one if the line was well formed.
+  inline size_t http_status_line_store(http_status_code &code, uint64_t &server_errors, int value) noexcept
+  {
+    code = (value >= 0) ? http_status_code(value) : http_status_code();
+    server_errors = (server_errors >> 1U) | (static_cast<uint64_t>(static_cast<unsigned>(value - 500) < 100U) << 63U);
+    return static_cast<size_t>(value >= 0);
+  }
+}  // namespace detail
+
+/*! \brief Parses the status code out of a HTTP/1.x response status line.
+
+The line must begin with `HTTP/1.x NNN`, where `x` and `NNN` are digits, followed
+by the end of the line, a space, or a carriage return or line feed. The reason
+phrase after the status code is ignored.
+
+\return The status code, or an empty code if the line is malformed.
+*/
+inline http_status_code parse_http_status_line(const char *line, size_t length) noexcept
+{
+  const int value = detail::parse_http_status_line(line, length);
+  return (value >= 0) ? http_status_code(value) : http_status_code();
+}
+
+//! The number of 64 bit words in a bitmap of `count` status lines, as filled by `parse_http_status_lines()`.
+inline constexpr size_t http_status_lines_bitmap_words(size_t count) noexcept
+{
+  return (count + 63) / 64;
+}
+
+/*! \brief Parses the status codes out of many HTTP/1.x response status lines at once.
+
+Each line is parsed as by `parse_http_status_line()`, with the code for
+`lines[n]` of `lengths[n]` bytes written to `codes[n]`. A malformed line gets
+an empty code.
+
+If `server_errors` is not null, it must point to
+`http_status_lines_bitmap_words(count)` words, which are overwritten with a
+bitmap in which bit `n % 64` of word `n / 64` is set if
+`codes[n].is_http_server_error()`. Counting the set bits then gives the number
+of upstream server errors.
+
+Where available, AVX2 checks two lines at a time and SSE2 one, else each line
+is checked a byte at a time. See `SYSTEM_ERROR2_HTTP_STATUS_LINE_SIMD`.
+
+\return The number of well formed lines.
+*/
+inline size_t parse_http_status_lines(http_status_code *codes, uint64_t *server_errors, const char *const *lines,
+                                      const size_t *lengths, size_t count) noexcept
+{
+  size_t parsed = 0;
+  for(size_t base = 0; base < count; base += 64)
+  {
+    const size_t todo = (count - base < 64) ? (count - base) : 64;
+    uint64_t word = 0;
+    size_t n = 0;
+#if SYSTEM_ERROR2_HTTP_STATUS_LINE_SIMD >= 2
+    for(; n + 1 < todo; n += 2)
+    {
+      int values[2];
+      detail::parse_http_status_line_pair_avx2(values, lines[base + n], lengths[base + n], lines[base + n + 1],
+                                               lengths[base + n + 1]);
+      parsed += detail::http_status_line_store(codes[base + n], word, values[0]);
+      parsed += detail::http_status_line_store(codes[base + n + 1], word, values[1]);
+    }
+#endif
+    for(; n < todo; n++)
+    {
+      parsed += detail::http_status_line_store(codes[base + n], word,
+                                               detail::parse_http_status_line(lines[base + n], lengths[base + n]));
+    }
+    if(server_errors != nullptr)
+    {
+      // The bit for the first line of a partial word must end up in the bottom bit
+      server_errors[base / 64] = word >> (64 - todo);
+    }
+  }
+  return parsed;
+}
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -0,0 +1,139 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_MESSAGE_ARENA_HPP
+#define SYSTEM_ERROR2_MESSAGE_ARENA_HPP
+
+#include "status_code.hpp"
+
+#include <cstdlib>  // for malloc
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! \brief A monotonic arena for message strings.
+
+Memory is handed out by bumping a pointer, first through an optional caller
+supplied buffer, then through blocks allocated from the heap as needed. Nothing
+is freed until `release()` or destruction, when everything is freed at once.
+
+Passing an arena to `message(const status_code<void> &, message_arena &)` copies the
+message into the arena as an `arena_string_ref` if it is rendered dynamically, as
+by `posix_code`, `std_error_code` and `boost_error_code`, and by any other domain
+using `status_code_domain::_copied_string_ref()`. These have no thunk, so copying
+and destroying them costs nothing, but they must not outlive the arena's release.
+Only messages so requested go into an arena, so plain `message()`, and the message
+kept by a `status_error`, are never within one.
+
+An arena is not thread safe. Use one per thread, or per request within a thread.
+*/
+class message_arena
+{
+  struct _block
+  {
+    _block *next;
+  };
+
+  char *const _buffer_begin{nullptr}, *const _buffer_end{nullptr};
+  char *_cursor{nullptr}, *_end{nullptr};
+  _block *_blocks{nullptr};
+  const size_t _block_size{4096};
+
+  static char *_allocate(void *arena, size_t bytes) { return static_cast<message_arena *>(arena)->allocate(bytes); }
+
+  friend status_code_domain::string_ref message(const status_code<void> &code, message_arena &arena) noexcept;
+
+public:
+  //! Constructs an arena which allocates blocks of at least `block_size` bytes from the heap.
+  explicit message_arena(size_t block_size = 4096) noexcept
+      : _block_size(block_size)
+  {
+  }
+  //! Constructs an arena which uses `buffer` first, then allocates blocks of at least `block_size` bytes from the heap.
+  message_arena(void *buffer, size_t bytes, size_t block_size = 4096) noexcept
+      : _buffer_begin(static_cast<char *>(buffer))
+      , _buffer_end(static_cast<char *>(buffer) + bytes)
+      , _cursor(_buffer_begin)
+      , _end(_buffer_end)
+      , _block_size(block_size)
+  {
+  }
+  message_arena(const message_arena &) = delete;
+  message_arena(message_arena &&) = delete;
+  message_arena &operator=(const message_arena &) = delete;
+  message_arena &operator=(message_arena &&) = delete;
+  ~message_arena() { release(); }
+
+  //! Returns `bytes` bytes of storage, or null if memory could not be allocated.
+  char *allocate(size_t bytes) noexcept
+  {
+    if(static_cast<size_t>(_end - _cursor) < bytes)
+    {
+      const size_t size = (bytes > _block_size) ? bytes : _block_size;
+      auto *block = static_cast<_block *>(malloc(sizeof(_block) + size));  // NOLINT
+      if(block == nullptr)
+      {
+        return nullptr;
+      }
+      block->next = _blocks;
+      _blocks = block;
+      _cursor = reinterpret_cast<char *>(block + 1);  // NOLINT
+      _end = _cursor + size;
+    }
+    char *ret = _cursor;
+    _cursor += bytes;
+    return ret;
+  }
+
+  //! Frees everything allocated, invalidating all strings within the arena.
+  void release() noexcept
+  {
+    while(_blocks != nullptr)
+    {
+      _block *next = _blocks->next;
+      free(_blocks);  // NOLINT
+      _blocks = next;
+    }
+    _cursor = _buffer_begin;
+    _end = _buffer_end;
+  }
+};
+
+/*! Return a reference to a string textually representing `code`, which if rendered
+dynamically by the domain, as the POSIX, `std::error_code` and `boost::system::error_code`
+domains do, is kept in `arena` rather than on the heap. It must not outlive the release
+of `arena`.
+*/
+inline status_code_domain::string_ref message(const status_code<void> &code, message_arena &arena) noexcept
+{
+  auto &hook = detail::current_message_arena();
+  const detail::message_arena_hook previous = hook;
+  hook = {&arena, &message_arena::_allocate};
+  status_code_domain::string_ref ret = code.message();
+  hook = previous;
+  return ret;
+}
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
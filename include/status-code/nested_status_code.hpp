@@ -27,10 +27,17 @@ http://www.boost.org/LICENSE_1_0.txt)
 
 #include "quick_status_code_from_enum.hpp"
 
-#include <memory>  // for allocator
+#include <cstddef>  // for max_align_t
+#include <memory>   // for allocator
+#include <new>      // for operator new
 
 SYSTEM_ERROR2_NAMESPACE_BEGIN
 
+#ifndef SYSTEM_ERROR2_THREAD_CACHING_POOL_ALLOCATOR_CACHE_SIZE
+//! The number of free blocks of each size which each thread may cache for `thread_caching_pool_allocator`.
+#define SYSTEM_ERROR2_THREAD_CACHING_POOL_ALLOCATOR_CACHE_SIZE 64
+#endif
+
 namespace detail
 {
   template <class StatusCode, class Allocator> class indirecting_domain : public status_code_domain
@@ -100,7 +107,7 @@ namespace detail
     {
       assert(code.domain() == *this);
       const auto &c = static_cast<const _mycode &>(code);  // NOLINT
-      return static_cast<status_code_domain &&>(typename StatusCode::domain_type())._do_failure(c.value()->sc);
+      return static_cast<status_code_domain &&>(typename StatusCode::domain_type())._failure(c.value()->sc);
     }
     virtual bool _do_equivalent(const status_code<void> &code1,
                                 const status_code<void> &code2) const noexcept override  // NOLINT
@@ -127,6 +134,16 @@ namespace detail
       args.ret = static_cast<string_ref &&>(args2.ret);
       return ret;
     }
+    virtual int _do_message_into(_vtable_message_into_args &args) const noexcept override
+    {
+      assert(args.code.domain() == *this);
+      const auto &c = static_cast<const _mycode &>(args.code);  // NOLINT
+      _vtable_message_into_args args2{args.buffer, args.length, c.value()->sc};
+      const int ret =
+      static_cast<status_code_domain &&>(typename StatusCode::domain_type())._do_message_into(args2);
+      args.ret = args2.ret;
+      return ret;
+    }
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
     SYSTEM_ERROR2_NORETURN virtual void _do_throw_exception(const status_code<void> &code) const override  // NOLINT
     {
@@ -187,8 +204,229 @@ namespace detail
     return _indirecting_domain<StatusCode, Allocator>;
   }
 #endif
+
+  /* As `indirecting_domain`, but the payload is reference counted, so copying
+  a code increments the count instead of allocating and copy constructing a
+  new payload. The layout of the payload begins with that of `payload_type`,
+  and the unique id is the same, so `get_if()` and `get_id()` work unchanged.
+  */
+  template <class StatusCode, class Allocator>
+  class shared_indirecting_domain : public indirecting_domain<StatusCode, Allocator>
+  {
+    template <class DomainType> friend class status_code;
+    using _base = indirecting_domain<StatusCode, Allocator>;
+
+  public:
+    using typename _base::payload_type;
+    struct shared_payload_type : payload_type
+    {
+      std::atomic<size_t> refcount{1};
+
+      shared_payload_type(StatusCode _sc, Allocator _alloc)
+          : payload_type(static_cast<StatusCode &&>(_sc), static_cast<Allocator &&>(_alloc))
+      {
+      }
+    };
+    using value_type = payload_type *;
+    using payload_allocator_traits =
+    typename payload_type::allocator_traits::template rebind_traits<shared_payload_type>;
+    using typename _base::string_ref;
+
+    constexpr shared_indirecting_domain() noexcept {}  // NOLINT
+
+#if __cplusplus < 201402L && !defined(_MSC_VER)
+    static inline const shared_indirecting_domain &get()
+    {
+      static shared_indirecting_domain v;
+      return v;
+    }
+#else
+    static inline constexpr const shared_indirecting_domain &get();
+#endif
+
+  protected:
+    using _mycode = status_code<shared_indirecting_domain>;
+
+    virtual int _do_erased_copy(status_code<void> &dst, const status_code<void> &src,
+                                typename _base::payload_info_t dstinfo) const noexcept override
+    {
+      // Note that dst may not have its domain set
+      const auto srcinfo = this->payload_info();
+      assert(src.domain() == *this);
+      if(dstinfo.total_size < srcinfo.total_size)
+      {
+        return ENOBUFS;
+      }
+      auto &d = static_cast<_mycode &>(dst);               // NOLINT
+      const auto &_s = static_cast<const _mycode &>(src);  // NOLINT
+      auto *p = static_cast<shared_payload_type *>(_s.value());
+      p->refcount.fetch_add(1, std::memory_order_relaxed);
+      new(SYSTEM_ERROR2_ADDRESS_OF(d)) _mycode(in_place, p);
+      return 0;
+    }
+    virtual void _do_erased_destroy(status_code<void> &code,
+                                    typename _base::payload_info_t /*unused*/) const noexcept override  // NOLINT
+    {
+      assert(code.domain() == *this);
+      auto &c = static_cast<_mycode &>(code);  // NOLINT
+      auto *p = static_cast<shared_payload_type *>(c.value());
+      if(p->refcount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      {
+        typename payload_allocator_traits::template rebind_alloc<shared_payload_type> payload_alloc(p->alloc);
+        payload_allocator_traits::destroy(payload_alloc, p);
+        payload_allocator_traits::deallocate(payload_alloc, p, 1);
+      }
+    }
+  };
+#if __cplusplus >= 201402L || defined(_MSC_VER)
+  template <class StatusCode, class Allocator>
+  constexpr shared_indirecting_domain<StatusCode, Allocator> _shared_indirecting_domain{};
+  template <class StatusCode, class Allocator>
+  inline constexpr const shared_indirecting_domain<StatusCode, Allocator> &
+  shared_indirecting_domain<StatusCode, Allocator>::get()
+  {
+    return _shared_indirecting_domain<StatusCode, Allocator>;
+  }
+#endif
+
+  /* The free list of blocks of `Bytes` bytes cached by each thread for
+  `thread_caching_pool_allocator`. The list is trivially destructible, so it
+  remains usable by thread local destructors which run after the reaper has
+  returned its blocks to the heap at thread exit. Thereafter the list is
+  closed, and deallocations go straight to the heap.
+  */
+  template <size_t Bytes> struct thread_caching_pool
+  {
+    struct block
+    {
+      block *next;
+    };
+    struct free_list
+    {
+      block *head;
+      size_t count;
+      bool armed, closed;
+    };
+    struct reaper
+    {
+      ~reaper()
+      {
+        free_list &l = list();
+        l.closed = true;
+        while(l.head != nullptr)
+        {
+          block *next = l.head->next;
+          ::operator delete(l.head);
+          l.head = next;
+        }
+        l.count = 0;
+      }
+    };
+
+    static free_list &list() noexcept
+    {
+      static thread_local free_list v;
+      return v;
+    }
+    static void arm() noexcept
+    {
+      static thread_local reaper v;
+      (void) v;
+      list().armed = true;
+    }
+    static void *allocate()
+    {
+      free_list &l = list();
+      if(l.head != nullptr)
+      {
+        block *b = l.head;
+        l.head = b->next;
+        --l.count;
+        return b;
+      }
+      return ::operator new(Bytes);
+    }
+    static void deallocate(void *p) noexcept
+    {
+      free_list &l = list();
+      if(l.closed || l.count >= SYSTEM_ERROR2_THREAD_CACHING_POOL_ALLOCATOR_CACHE_SIZE)
+      {
+        ::operator delete(p);
+        return;
+      }
+      if(!l.armed)
+      {
+        arm();
+      }
+      auto *b = static_cast<block *>(p);
+      b->next = l.head;
+      l.head = b;
+      ++l.count;
+    }
+  };
 }  // namespace detail
 
+/*! \brief A fixed size block allocator which keeps a small cache of free
+blocks per thread.
+
+Single object allocations are rounded up to a multiple of sixteen bytes, and
+served from, and returned to, a free list private to the calling thread. Up to
+`SYSTEM_ERROR2_THREAD_CACHING_POOL_ALLOCATOR_CACHE_SIZE` free blocks of each size
+are kept per thread, beyond which blocks go back to the global heap, as do all
+blocks cached by a thread when it exits. Blocks freed by a thread other than
+the allocating thread are simply cached by the freeing thread. Array and over
+aligned allocations are passed through to `std::allocator<T>`.
+
+This is intended to be passed to `make_nested_status_code()` or
+`make_shared_nested_status_code()`, which rebind it to their payload type, so
+that nesting and cloning codes at high rates avoids the global heap.
+*/
+template <class T> class thread_caching_pool_allocator
+{
+  static constexpr size_t _bytes = (sizeof(T) + 15) & ~static_cast<size_t>(15);
+  static constexpr bool _pooled(size_t n) noexcept { return n == 1 && alignof(T) <= alignof(std::max_align_t); }
+
+public:
+  //! The type allocated
+  using value_type = T;
+
+  //! Default constructor
+  thread_caching_pool_allocator() noexcept = default;
+  //! Converting constructor
+  template <class U> thread_caching_pool_allocator(const thread_caching_pool_allocator<U> & /*unused*/) noexcept {}
+
+  //! Allocates storage for `n` objects
+  T *allocate(size_t n)
+  {
+    if(_pooled(n))
+    {
+      return static_cast<T *>(detail::thread_caching_pool<_bytes>::allocate());
+    }
+    return std::allocator<T>().allocate(n);
+  }
+  //! Deallocates storage for `n` objects
+  void deallocate(T *p, size_t n) noexcept
+  {
+    if(_pooled(n))
+    {
+      detail::thread_caching_pool<_bytes>::deallocate(p);
+      return;
+    }
+    std::allocator<T>().deallocate(p, n);
+  }
+
+  //! All instances are interchangeable
+  template <class U> bool operator==(const thread_caching_pool_allocator<U> & /*unused*/) const noexcept
+  {
+    return true;
+  }
+  //! All instances are interchangeable
+  template <class U> bool operator!=(const thread_caching_pool_allocator<U> & /*unused*/) const noexcept
+  {
+    return false;
+  }
+};
+
 /*! Make an erased status code which indirects to a dynamically allocated status code,
 using the allocator `alloc`.
 
@@ -222,6 +460,41 @@ make_nested_status_code(T &&v, Alloc alloc = {})
 #endif
 }
 
+/*! Make an erased status code which indirects to a dynamically allocated, reference
+counted, status code, using the allocator `alloc`.
+
+This is as `make_nested_status_code()`, except that copying the erased status code
+e.g. via `clone()` shares the original allocation, incrementing its reference count,
+instead of allocating and copy constructing a new one. The nested status code is
+destroyed when the last copy is. Note that this function can throw if the allocator throws.
+*/
+SYSTEM_ERROR2_TEMPLATE(class T, class Alloc = std::allocator<typename std::decay<T>::type>)
+SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(is_status_code<T>::value))  //
+inline status_code<detail::erased<typename std::add_pointer<typename std::decay<T>::type>::type>>
+make_shared_nested_status_code(T &&v, Alloc alloc = {})
+{
+  using status_code_type = typename std::decay<T>::type;
+  using domain_type = detail::shared_indirecting_domain<status_code_type, typename std::decay<Alloc>::type>;
+  using payload_allocator_traits = typename domain_type::payload_allocator_traits;
+  typename payload_allocator_traits::template rebind_alloc<typename domain_type::shared_payload_type> payload_alloc(
+  alloc);
+  auto *p = payload_allocator_traits::allocate(payload_alloc, 1);
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
+  try
+#endif
+  {
+    payload_allocator_traits::construct(payload_alloc, p, static_cast<T &&>(v), static_cast<Alloc &&>(alloc));
+    return status_code<domain_type>(in_place, p);
+  }
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
+  catch(...)
+  {
+    payload_allocator_traits::deallocate(payload_alloc, p, 1);
+    throw;
+  }
+#endif
+}
+
 /*! If a status code refers to a `nested_status_code` which indirects to a status
 code of type `StatusCode`, return a pointer to that `StatusCode`. Otherwise return null.
 */
@@ -80,29 +80,10 @@ class _nt_code_domain : public status_code_domain
   template <class DomainType> friend class status_code;
   friend class _com_code_domain;
   using _base = status_code_domain;
-  static int _nt_code_to_errno(win32::NTSTATUS c)
-  {
-    if(c >= 0)
-    {
-      return 0;  // success
-    }
-    switch(static_cast<unsigned>(c))
-    {
-#include "detail/nt_code_to_generic_code.ipp"
-    }
-    return -1;
-  }
+  static int _nt_code_to_errno(win32::NTSTATUS c) { return detail::nt_code_to_errno(static_cast<uint32_t>(c)); }
   static win32::DWORD _nt_code_to_win32_code(win32::NTSTATUS c)  // NOLINT
   {
-    if(c >= 0)
-    {
-      return 0;  // success
-    }
-    switch(static_cast<unsigned>(c))
-    {
-#include "detail/nt_code_to_win32_code.ipp"
-    }
-    return static_cast<win32::DWORD>(-1);
+    return static_cast<win32::DWORD>(detail::nt_code_to_win32_code(static_cast<uint32_t>(c)));
   }
   //! Construct from a NT error code
   static _base::string_ref _make_string_ref(int &errcode, win32::NTSTATUS c) noexcept
@@ -159,9 +140,21 @@ public:
   using _base::string_ref;
 
 public:
+  //! Describes this domain's values, see `status_code_domain::value_info_t`
+  static constexpr value_info_t _default_value_info() noexcept
+  {
+    return _make_value_info<value_type>(value_info_t::failure_kind::less, 0);
+  }
   //! Default constructor
   constexpr explicit _nt_code_domain(typename _base::unique_id_type id = 0x93f3b4487e4af25b) noexcept
-      : _base(id)
+      : _base(id, _own_value_info(id, 0x93f3b4487e4af25b, _default_value_info()))
+  {
+  }
+  /*! Constructor for a domain derived from this one, which by passing `value_info` opts into
+  `failure()` and `equivalent()` being determined from it where possible.
+  */
+  constexpr _nt_code_domain(typename _base::unique_id_type id, value_info_t value_info) noexcept
+      : _base(id, value_info)
   {
   }
   _nt_code_domain(const _nt_code_domain &) = default;
@@ -0,0 +1,179 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_PACKED_STATUS_CODE_HPP
+#define SYSTEM_ERROR2_PACKED_STATUS_CODE_HPP
+
+#include "domain_registry.hpp"
+#include "system_code.hpp"
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! \brief A status code packed into 64 bits, for dense storage of many outcomes.
+
+The top 16 bits are the index of the domain in the process wide domain registry,
+the bottom 48 bits the value. Only codes whose domain describes an integral value
+via `status_code_domain::value_info()` can be packed, and then only if that value
+fits into 48 bits and the domain's code would fit into a `system_code`. Domains not
+already registered are registered upon first being packed.
+
+Unpacking to a `system_code` is lossless, as codes of such domains are wholly
+described by their domain and value.
+
+Equality is exact, not semantic. Unpack to compare semantically.
+*/
+class packed_status_code
+{
+  static constexpr unsigned value_bits = 48;
+  static constexpr unsigned long long value_mask = (1ULL << value_bits) - 1;
+
+  unsigned long long _v{0};
+
+  static unsigned long long _pack(const status_code<void> &code) noexcept
+  {
+    const status_code_domain *domain = code.empty() ? nullptr : &code.domain();
+    long long value;
+    if(domain == nullptr || !detail::status_code_domain_access::load_integral_value(*domain, value, code) ||
+       domain->payload_info().total_size > sizeof(system_code))
+    {
+      return 0;
+    }
+    const auto &info = domain->value_info();
+    const bool fits = info.is_signed ? (value >= -(1LL << (value_bits - 1)) && value < (1LL << (value_bits - 1))) :
+                                       (static_cast<unsigned long long>(value) <= value_mask);
+    if(!fits)
+    {
+      return 0;
+    }
+    auto &registry = detail::domain_registry::get();
+    size_t idx = registry.find(domain->id());
+    if(idx == 0)
+    {
+      idx = registry.add(domain);
+      if(idx == 0)
+      {
+        return 0;
+      }
+    }
+    return (static_cast<unsigned long long>(idx) << value_bits) | (static_cast<unsigned long long>(value) & value_mask);
+  }
+
+  long long _value(const status_code_domain *d) const noexcept
+  {
+    const unsigned long long raw = _v & value_mask;
+    if(d != nullptr && d->value_info().is_signed)
+    {
+      constexpr unsigned long long sign = 1ULL << (value_bits - 1);
+      return static_cast<long long>((raw ^ sign) - sign);
+    }
+    return static_cast<long long>(raw);
+  }
+
+public:
+  //! Default construction to empty
+  packed_status_code() = default;
+  /*! Packs `code`. If `code` cannot be packed, or the domain registry is full, the
+  packed code is empty. Use `can_pack()` to tell apart an empty code from a failure to pack.
+  */
+  explicit packed_status_code(const status_code<void> &code) noexcept
+      : _v(_pack(code))
+  {
+  }
+
+  //! True if `code` is empty, or can be packed.
+  static bool can_pack(const status_code<void> &code) noexcept { return code.empty() || _pack(code) != 0; }
+
+  //! Constructs from bits previously returned by `bits()` within this process.
+  static constexpr packed_status_code from_bits(unsigned long long v) noexcept { return packed_status_code(v, 0); }
+  //! The packed bits. Domain indices are specific to this process.
+  constexpr unsigned long long bits() const noexcept { return _v; }
+
+  //! True if the packed code is empty.
+  constexpr bool empty() const noexcept { return _v == 0; }
+  //! The index of the domain in the domain registry, or zero if empty.
+  constexpr size_t domain_index() const noexcept { return static_cast<size_t>(_v >> value_bits); }
+  //! The domain, or null if empty.
+  const status_code_domain *domain() const noexcept { return detail::domain_registry::get().domain(domain_index()); }
+  //! The value, sign extended if the domain's value is signed.
+  long long value() const noexcept { return _value(domain()); }
+
+  //! True if the code is a failure. Does not unpack if the domain describes how failure is determined from the value.
+  bool failure() const noexcept
+  {
+    const status_code_domain *d = domain();
+    if(d == nullptr)
+    {
+      return false;
+    }
+    const auto &info = d->value_info();
+    if(info.failure != status_code_domain::value_info_t::failure_kind::opaque)
+    {
+      const auto v = static_cast<unsigned long long>(_value(d));
+      return ((v ^ info._bias) >= info._threshold_key) != info._invert;
+    }
+    return unpack().failure();
+  }
+  //! True if the code is a success.
+  bool success() const noexcept { return !empty() && !failure(); }
+
+  //! Reconstitutes the status code, as if the code of its domain with its value had been erased into a `system_code`.
+  system_code unpack() const noexcept
+  {
+    const status_code_domain *d = domain();
+    system_code ret;
+    if(d != nullptr)
+    {
+      // The value is stored where and as the domain describes, which does not depend on endianness
+      alignas(system_code) char image[sizeof(system_code)] = {};
+      if(detail::status_code_domain_access::store_integral_value(*d, image, sizeof(image), _value(d)))
+      {
+        memcpy(static_cast<void *>(&ret), image, sizeof(ret));
+      }
+    }
+    return ret;
+  }
+
+  //! Exact comparison of domain and value.
+  friend constexpr bool operator==(const packed_status_code &a, const packed_status_code &b) noexcept
+  {
+    return a._v == b._v;
+  }
+  //! Exact comparison of domain and value.
+  friend constexpr bool operator!=(const packed_status_code &a, const packed_status_code &b) noexcept
+  {
+    return a._v != b._v;
+  }
+
+private:
+  constexpr packed_status_code(unsigned long long v, int /*unused*/) noexcept
+      : _v(v)
+  {
+  }
+};
+
+static_assert(sizeof(packed_status_code) == 8, "packed_status_code is not eight bytes in size!");
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -33,6 +33,12 @@ http://www.boost.org/LICENSE_1_0.txt)
 
 #include <cstring>  // for strchr and strerror_r
 
+#ifndef SYSTEM_ERROR2_POSIX_CODE_MESSAGE_CACHE_SIZE
+//! The number of `errno` values, counting from zero, whose messages `posix_code` caches on first use. Set to
+//! zero to disable.
+#define SYSTEM_ERROR2_POSIX_CODE_MESSAGE_CACHE_SIZE 160
+#endif
+
 #if defined(_MSC_VER) && !defined(__clang__)
 #pragma warning(push)
 #pragma warning(disable : 6326)  // constant comparison
@@ -82,26 +88,98 @@ class _posix_code_domain : public status_code_domain
   template <class DomainType> friend class status_code;
   using _base = status_code_domain;
 
-  static _base::string_ref _make_string_ref(int &errcode, int c) noexcept
+  // Fills buffer with the system's message for c, returning any errno set whilst doing so
+  static int _fill_message(char *buffer, size_t len, int c) noexcept
   {
-    char buffer[1024] = "";
+    buffer[0] = 0;
     errno = 0;
 #ifdef _WIN32
-    strerror_s(buffer, sizeof(buffer), c);
+    strerror_s(buffer, len, c);
 #elif defined(__GLIBC__) && !defined(__UCLIBC__)  // handle glibc's weird strerror_r()
-    char *s = detail::avoid_string_include::strerror_r(c, buffer, sizeof(buffer));  // NOLINT
-    if(s != nullptr)
+    char *s = detail::avoid_string_include::strerror_r(c, buffer, len);  // NOLINT
+    if(s != nullptr && s != buffer)
     {
-      strncpy(buffer, s, sizeof(buffer) - 1);  // NOLINT
-      buffer[1023] = 0;
+      strncpy(buffer, s, len - 1);  // NOLINT
+      buffer[len - 1] = 0;
     }
 #elif !defined(__APPLE__)
-    detail::avoid_string_include::strerror_r(c, buffer, sizeof(buffer));
+    detail::avoid_string_include::strerror_r(c, buffer, len);
+#else
+    strerror_r(c, buffer, len);
+#endif
+    return errno;
+  }
+
+#if SYSTEM_ERROR2_POSIX_CODE_MESSAGE_CACHE_SIZE > 0
+  /* An immutable table of the messages for errno values [0, SYSTEM_ERROR2_POSIX_CODE_MESSAGE_CACHE_SIZE),
+  built once on first use. Messages are therefore in the locale current at that time.
+  */
+  struct _message_cache
+  {
+    static constexpr size_t _max_items = SYSTEM_ERROR2_POSIX_CODE_MESSAGE_CACHE_SIZE;
+    const char *_begin[_max_items];
+    const char *_end[_max_items];
+    char _buffer[_max_items * 64];
+
+    _message_cache() noexcept
+    {
+      char *p = _buffer;
+      const char *const e = _buffer + sizeof(_buffer);
+      for(size_t n = 0; n < _max_items; n++)
+      {
+        _begin[n] = _end[n] = nullptr;
+        if(p == e || _fill_message(p, static_cast<size_t>(e - p), static_cast<int>(n)) != 0)
+        {
+          continue;
+        }
+        const size_t len = strlen(p);
+        if(p + len + 1 == e)
+        {
+          continue;  // possibly truncated, leave it to the uncached path
+        }
+        _begin[n] = p;
+        _end[n] = p + len;
+        p += len + 1;
+      }
+    }
+    static const _message_cache &get() noexcept
+    {
+      static const _message_cache v;
+      return v;
+    }
+  };
+#endif
+
+  // Returns the cached message for c if there is one, else null
+  static const char *_cached_message(size_t &len, int c) noexcept
+  {
+#if SYSTEM_ERROR2_POSIX_CODE_MESSAGE_CACHE_SIZE > 0
+    if(c >= 0 && static_cast<size_t>(c) < _message_cache::_max_items)
+    {
+      const auto &cache = _message_cache::get();
+      if(cache._begin[c] != nullptr)
+      {
+        len = static_cast<size_t>(cache._end[c] - cache._begin[c]);
+        return cache._begin[c];
+      }
+    }
 #else
-    strerror_r(c, buffer, sizeof(buffer));
+    (void) len;
+    (void) c;
 #endif
-    errcode = errno;
-    return _base::atomic_refcounted_string_ref(buffer);
+    return nullptr;
+  }
+
+  static _base::string_ref _make_string_ref(int &errcode, int c) noexcept
+  {
+    size_t len = 0;
+    if(const char *msg = _cached_message(len, c))
+    {
+      return _base::string_ref(msg, len);
+    }
+    char buffer[1024];
+    errcode = _fill_message(buffer, sizeof(buffer), c);
+    return _base::_copied_string_ref(buffer);
   }
 
 public:
@@ -109,9 +187,21 @@ public:
   using value_type = int;
   using _base::string_ref;
 
+  //! Describes this domain's values, see `status_code_domain::value_info_t`
+  static constexpr value_info_t _default_value_info() noexcept
+  {
+    return _make_value_info<value_type>(value_info_t::failure_kind::nonzero).with_generic_code_identity();
+  }
   //! Default constructor
   constexpr explicit _posix_code_domain(typename _base::unique_id_type id = 0xa59a56fe5f310933) noexcept
-      : _base(id)
+      : _base(id, _own_value_info(id, 0xa59a56fe5f310933, _default_value_info()))
+  {
+  }
+  /*! Constructor for a domain derived from this one, which by passing `value_info` opts into
+  `failure()` and `equivalent()` being determined from it where possible.
+  */
+  constexpr _posix_code_domain(typename _base::unique_id_type id, value_info_t value_info) noexcept
+      : _base(id, value_info)
   {
   }
   _posix_code_domain(const _posix_code_domain &) = default;
@@ -177,6 +267,24 @@ protected:
     args.ret = _make_string_ref(errcode, c.value());
     return errcode;
   }
+  virtual int _do_message_into(_vtable_message_into_args &args) const noexcept override  // NOLINT
+  {
+    assert(args.code.domain() == *this);                         // NOLINT
+    const auto &c = static_cast<const posix_code &>(args.code);  // NOLINT
+    size_t len = 0;
+    if(const char *msg = _cached_message(len, c.value()))
+    {
+      args.ret = _copy_string_into(args.buffer, args.length, msg, len);
+      return 0;
+    }
+    if(args.length == 0)
+    {
+      return 0;
+    }
+    const int errcode = _fill_message(args.buffer, args.length, c.value());
+    args.ret = strlen(args.buffer);
+    return errcode;
+  }
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
   SYSTEM_ERROR2_NORETURN virtual void _do_throw_exception(const status_code<void> &code) const override  // NOLINT
   {
@@ -194,6 +302,28 @@ inline constexpr const _posix_code_domain &_posix_code_domain::get()
   return posix_code_domain;
 }
 
+namespace traits
+{
+  //! POSIX codes are equivalent if their values are equal.
+  template <> struct static_equivalence<_posix_code_domain, _posix_code_domain>
+  {
+    static constexpr bool value = true;
+    static constexpr bool equivalent(const posix_code &a, const posix_code &b) noexcept
+    {
+      return a.value() == b.value();
+    }
+  };
+  //! A POSIX code is equivalent to a generic code with the same `errno` value.
+  template <> struct static_equivalence<_posix_code_domain, _generic_code_domain>
+  {
+    static constexpr bool value = true;
+    static constexpr bool equivalent(const posix_code &a, const generic_code &b) noexcept
+    {
+      return a.value() == static_cast<int>(b.value());
+    }
+  };
+}  // namespace traits
+
 namespace mixins
 {
   template <class Base> inline posix_code mixin<Base, _posix_code_domain>::current() noexcept
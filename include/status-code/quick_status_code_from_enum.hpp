@@ -29,8 +29,15 @@ http://www.boost.org/LICENSE_1_0.txt)
 #define SYSTEM_ERROR2_QUICK_STATUS_CODE_FROM_ENUM_ASSERT_ON_MISSING_MAPPING_TABLE_ENTRIES 1
 #endif
 
+#ifndef SYSTEM_ERROR2_QUICK_STATUS_CODE_FROM_ENUM_INDEX_THRESHOLD
+//! Mapping tables with fewer entries than this are searched linearly rather than indexed.
+#define SYSTEM_ERROR2_QUICK_STATUS_CODE_FROM_ENUM_INDEX_THRESHOLD 8
+#endif
+
 #include "generic_code.hpp"
 
+#include <cstdint>
+
 SYSTEM_ERROR2_NAMESPACE_BEGIN
 
 template <class Enum> class _quick_status_code_from_enum_domain;
@@ -62,6 +69,170 @@ template <class Enum> struct quick_status_code_from_enum_defaults
   };
 };
 
+namespace detail
+{
+  /*! \brief An index over a `quick_status_code_from_enum` mapping table giving constant time lookup.
+
+  If the enumeration's values are reasonably dense, the index is an array of mapping table indices
+  indexed by value. Otherwise it is an open addressed hash table. Alongside is a bitset of which
+  mapping table entries are failures, so `failure()` is a single bit test.
+
+  Tables shorter than `SYSTEM_ERROR2_QUICK_STATUS_CODE_FROM_ENUM_INDEX_THRESHOLD` are not indexed,
+  nor are tables for which memory could not be allocated, and are searched linearly instead.
+
+  The index lives in a function local static, and its memory is intentionally leaked rather than
+  freed by a destructor, so codes remain usable during static deinitialisation. There is one such
+  allocation per enumeration, sized in proportion to its mapping table.
+  */
+  template <class Mapping> class quick_status_code_from_enum_index
+  {
+    using _enum = typename Mapping::enumeration_type;
+
+    const Mapping *_begin{nullptr};
+    size_t _count{0};
+    uint64_t _min{0};
+    uint64_t _mask{0};        // capacity of _slots less one
+    unsigned _shift{0};       // 64 less log2 of the capacity of _slots, when hashed
+    bool _dense{false};       // _slots is indexed by (key - _min) rather than hashed
+    uint32_t *_slots{nullptr};  // mapping table index plus one, zero being empty
+    uint64_t *_failures{nullptr};
+
+    // Map the value to an unsigned integer preserving order, so signed enums have a sensible range
+    template <class T> static constexpr uint64_t _key_impl(T v, std::true_type /*is enum*/) noexcept
+    {
+      using underlying = typename std::underlying_type<T>::type;
+      return std::is_signed<underlying>::value ?
+             (static_cast<uint64_t>(static_cast<int64_t>(static_cast<underlying>(v))) ^ (uint64_t(1) << 63U)) :
+             static_cast<uint64_t>(static_cast<underlying>(v));
+    }
+    // Types which are not enumerations are never indexed
+    template <class T> static constexpr uint64_t _key_impl(const T & /*unused*/, std::false_type /*is enum*/) noexcept
+    {
+      return 0;
+    }
+    static constexpr uint64_t _key(const _enum &v) noexcept { return _key_impl(v, std::is_enum<_enum>()); }
+    // Fibonacci hashing, whose well mixed bits are the top ones, so the slot is taken from those
+    uint64_t _hash(uint64_t key) const noexcept { return (key * 0x9e3779b97f4a7c15ULL) >> _shift; }
+    static bool _is_failure(const Mapping &m) noexcept
+    {
+      // If `errc::success` is in the generic code mapping, it is not a failure
+      for(errc ec : m.code_mappings)
+      {
+        if(ec == errc::success)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+    uint32_t *_slot_for(uint64_t key) const noexcept
+    {
+      if(_dense)
+      {
+        const uint64_t offset = key - _min;
+        return (offset <= _mask) ? &_slots[offset] : nullptr;
+      }
+      for(uint64_t n = _hash(key);; n++)
+      {
+        uint32_t *slot = &_slots[n & _mask];
+        if(*slot == 0 || _key(_begin[*slot - 1].value) == key)
+        {
+          return slot;
+        }
+      }
+    }
+
+  public:
+    //! Sentinel returned by `find()` when there is no mapping table entry
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    //! Builds the index for the mapping table `mappings`
+    explicit quick_status_code_from_enum_index(const std::initializer_list<Mapping> &mappings) noexcept
+    {
+      // `value_mappings()` returns a reference to a static, so its underlying array lives forever
+      _begin = mappings.begin();
+      _count = mappings.size();
+      if(!std::is_enum<_enum>::value || _count < SYSTEM_ERROR2_QUICK_STATUS_CODE_FROM_ENUM_INDEX_THRESHOLD ||
+         _count >= UINT32_MAX)
+      {
+        return;
+      }
+      uint64_t max = 0;
+      _min = UINT64_MAX;
+      for(const auto &i : mappings)
+      {
+        const uint64_t key = _key(i.value);
+        _min = (key < _min) ? key : _min;
+        max = (key > max) ? key : max;
+      }
+      uint64_t capacity = 1;
+      if(max - _min < _count * 4)
+      {
+        _dense = true;
+        capacity = max - _min + 1;
+      }
+      else
+      {
+        _shift = 64;
+        while(capacity < _count * 2)
+        {
+          capacity <<= 1U;
+          _shift--;
+        }
+      }
+      const size_t failure_words = (_count + 63) / 64;
+      // Intentionally leaked, see above
+      auto *mem = static_cast<uint64_t *>(calloc(failure_words * sizeof(uint64_t) + capacity * sizeof(uint32_t), 1));
+      if(mem == nullptr)
+      {
+        _dense = false;
+        return;
+      }
+      _failures = mem;
+      _slots = reinterpret_cast<uint32_t *>(mem + failure_words);  // NOLINT
+      _mask = capacity - 1;
+      for(size_t n = 0; n < _count; n++)
+      {
+        // Where values repeat, the first entry wins, same as a linear search
+        uint32_t *slot = _slot_for(_key(_begin[n].value));
+        if(*slot == 0)
+        {
+          *slot = static_cast<uint32_t>(n + 1);
+        }
+        if(_is_failure(_begin[n]))
+        {
+          _failures[n / 64] |= uint64_t(1) << (n % 64);
+        }
+      }
+    }
+
+    //! Returns the index into the mapping table of `v`, or `npos` if not found
+    size_t find(const _enum &v) const noexcept
+    {
+      if(_slots != nullptr)
+      {
+        const uint32_t *slot = _slot_for(_key(v));
+        return (slot != nullptr && *slot != 0) ? static_cast<size_t>(*slot - 1) : npos;
+      }
+      for(size_t n = 0; n < _count; n++)
+      {
+        if(_begin[n].value == v)
+        {
+          return n;
+        }
+      }
+      return npos;
+    }
+    //! Returns the mapping table entry at `idx`, which must not be `npos`
+    const Mapping &operator[](size_t idx) const noexcept { return _begin[idx]; }
+    //! True if the mapping table entry at `idx` has no `errc::success` equivalent
+    bool is_failure(size_t idx) const noexcept
+    {
+      return (_failures != nullptr) ? ((_failures[idx / 64] >> (idx % 64)) & 1U) != 0 : _is_failure(_begin[idx]);
+    }
+  };
+}  // namespace detail
+
 /*! The implementation of the domain for status codes wrapping `Enum` generated from `quick_status_code_from_enum`.
  */
 template <class Enum> class _quick_status_code_from_enum_domain : public status_code_domain
@@ -76,7 +247,8 @@ public:
   using _base::string_ref;
 
   constexpr _quick_status_code_from_enum_domain()
-      : status_code_domain(_src::domain_uuid, _uuid_size<detail::cstrlen(_src::domain_uuid)>())
+      : status_code_domain(_src::domain_uuid, _uuid_size<detail::cstrlen(_src::domain_uuid)>(),
+                           _make_value_info<value_type>())
   {
   }
   _quick_status_code_from_enum_domain(const _quick_status_code_from_enum_domain &) = default;
@@ -96,18 +268,18 @@ public:
 #endif
 
 protected:
-  // Not sure if a hash table is worth it here, most enumerations won't be long enough to be worth it
-  // Also, until C++ 20's consteval, the hash table would get emitted into the binary, bloating it
-  static SYSTEM_ERROR2_CONSTEXPR14 const typename _src::mapping *_find_mapping(value_type v) noexcept
+  using _index_type = detail::quick_status_code_from_enum_index<typename _src::mapping>;
+  // Built on first use as `value_mappings()` is not constexpr
+  static const _index_type &_index() noexcept
   {
-    for(const auto &i : _src::value_mappings())
-    {
-      if(i.value == v)
-      {
-        return &i;
-      }
-    }
-    return nullptr;
+    static const _index_type v(_src::value_mappings());
+    return v;
+  }
+  static const typename _src::mapping *_find_mapping(value_type v) noexcept
+  {
+    const auto &index = _index();
+    const size_t idx = index.find(v);
+    return (idx != _index_type::npos) ? &index[idx] : nullptr;
   }
 
   SYSTEM_ERROR2_CONSTEXPR20 virtual int _do_name(_vtable_name_args &args) const noexcept override
@@ -125,23 +297,12 @@ protected:
   virtual bool _do_failure(const status_code<void> &code) const noexcept override
   {
     assert(code.domain() == *this);  // NOLINT
-    // If `errc::success` is in the generic code mapping, it is not a failure
-    const auto *mapping =
-    _find_mapping(static_cast<const quick_status_code_from_enum_code<value_type> &>(code).value());
+    const auto &index = _index();
+    const size_t idx = index.find(static_cast<const quick_status_code_from_enum_code<value_type> &>(code).value());
 #if SYSTEM_ERROR2_QUICK_STATUS_CODE_FROM_ENUM_ASSERT_ON_MISSING_MAPPING_TABLE_ENTRIES
-    assert(mapping != nullptr);  // if this fires, you forgot to add the enum to the mapping table
+    assert(idx != _index_type::npos);  // if this fires, you forgot to add the enum to the mapping table
 #endif
-    if(mapping != nullptr)
-    {
-      for(errc ec : mapping->code_mappings)
-      {
-        if(ec == errc::success)
-        {
-          return false;
-        }
-      }
-    }
-    return true;
+    return idx == _index_type::npos || index.is_failure(idx);
   }
   virtual bool _do_equivalent(const status_code<void> &code1, const status_code<void> &code2) const noexcept override
   {
@@ -0,0 +1,245 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+
+#ifndef SYSTEM_ERROR2_REMOTE_COM_CODE_HPP
+#define SYSTEM_ERROR2_REMOTE_COM_CODE_HPP
+
+#include "remote_nt_code.hpp"
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+class _remote_com_code_domain;
+/*! A COM error code, a `HRESULT`, received from a Windows machine, which can be decoded on any platform.
+As with `com_code`, semantic equivalence testing is only implemented for `FACILITY_WIN32` and `FACILITY_NT_BIT`,
+which are decoded into the remote Win32 and NT codes they wrap.
+*/
+using remote_com_code = status_code<_remote_com_code_domain>;
+//! A specialisation of `status_error` for the remote COM error code domain.
+using remote_com_error = status_error<_remote_com_code_domain>;
+
+/*! The implementation of the domain for COM error codes received from a Windows machine. Unlike `com_code`,
+this is available on every platform, but as the message tables are on the Windows machine, messages are
+the code followed by the message of the generic code it maps onto.
+*/
+class _remote_com_code_domain : public status_code_domain
+{
+  template <class DomainType> friend class status_code;
+  template <class DomainType1, class DomainType2> friend struct traits::static_equivalence;
+  using _base = status_code_domain;
+
+  static constexpr uint32_t _facility_nt_bit = 0x10000000;  // FACILITY_NT_BIT
+  static constexpr uint32_t _facility_win32 = 7;            // FACILITY_WIN32
+
+  // True if the `HRESULT` wraps an NT code
+  static constexpr bool _is_nt_code(int32_t c) noexcept { return (static_cast<uint32_t>(c) & _facility_nt_bit) != 0; }
+  // True if the `HRESULT` wraps a Win32 code
+  static constexpr bool _is_win32_code(int32_t c) noexcept
+  {
+    return !_is_nt_code(c) && ((static_cast<uint32_t>(c) >> 16U) & 0x1fffU) == _facility_win32;
+  }
+  // The NT code wrapped by the `HRESULT`
+  static constexpr uint32_t _nt_code(int32_t c) noexcept { return static_cast<uint32_t>(c) & ~_facility_nt_bit; }
+  // The Win32 code wrapped by the `HRESULT`
+  static constexpr uint32_t _win32_code(int32_t c) noexcept { return static_cast<uint32_t>(c) & 0xffffU; }
+  // The `errno` equivalent of a `HRESULT`, -1 if it has none
+  static SYSTEM_ERROR2_CONSTEXPR14 int _com_code_to_errno(int32_t c) noexcept
+  {
+    if(c == 0)
+    {
+      return 0;  // S_OK
+    }
+    if(_is_nt_code(c))
+    {
+      return detail::nt_code_to_errno(_nt_code(c));
+    }
+    if(_is_win32_code(c))
+    {
+      return detail::win32_code_to_errno(_win32_code(c));
+    }
+    return -1;
+  }
+  static size_t _make_message(char *buffer, int32_t c) noexcept
+  {
+    return detail::remote_windows_code_message(buffer, "HRESULT ", static_cast<uint32_t>(c), true,
+                                               _com_code_to_errno(c));
+  }
+
+public:
+  //! The value type of the remote COM code, which is the 32 bit `HRESULT` of Windows
+  using value_type = int32_t;
+  using _base::string_ref;
+
+public:
+  //! Describes this domain's values, see `status_code_domain::value_info_t`
+  static constexpr value_info_t _default_value_info() noexcept
+  {
+    return _make_value_info<value_type>(value_info_t::failure_kind::less, 0);
+  }
+  //! Default constructor
+  constexpr explicit _remote_com_code_domain(typename _base::unique_id_type id = 0x5c1407c587b22530) noexcept
+      : _base(id, _own_value_info(id, 0x5c1407c587b22530, _default_value_info()))
+  {
+  }
+  /*! Constructor for a domain derived from this one, which by passing `value_info` opts into
+  `failure()` and `equivalent()` being determined from it where possible.
+  */
+  constexpr _remote_com_code_domain(typename _base::unique_id_type id, value_info_t value_info) noexcept
+      : _base(id, value_info)
+  {
+  }
+  _remote_com_code_domain(const _remote_com_code_domain &) = default;
+  _remote_com_code_domain(_remote_com_code_domain &&) = default;
+  _remote_com_code_domain &operator=(const _remote_com_code_domain &) = default;
+  _remote_com_code_domain &operator=(_remote_com_code_domain &&) = default;
+  ~_remote_com_code_domain() = default;
+
+  //! Constexpr singleton getter. Returns the constexpr remote_com_code_domain variable.
+  static inline constexpr const _remote_com_code_domain &get();
+
+protected:
+  SYSTEM_ERROR2_CONSTEXPR20 virtual int _do_name(_vtable_name_args &args) const noexcept override
+  {
+    args.ret = string_ref("remote COM domain");
+    return 0;
+  }  // NOLINT
+  SYSTEM_ERROR2_CONSTEXPR20 virtual void _do_payload_info(_vtable_payload_info_args &args) const noexcept override
+  {
+    args.ret = {sizeof(value_type), sizeof(status_code_domain *) + sizeof(value_type),
+                (alignof(value_type) > alignof(status_code_domain *)) ? alignof(value_type) :
+                                                                        alignof(status_code_domain *)};
+  }
+  SYSTEM_ERROR2_CONSTEXPR20 virtual bool _do_failure(const status_code<void> &code) const noexcept override  // NOLINT
+  {
+    assert(code.domain() == *this);                                 // NOLINT
+    return static_cast<const remote_com_code &>(code).value() < 0;  // NOLINT
+  }
+  /*! Note semantic equivalence testing is only implemented for `FACILITY_WIN32` and `FACILITY_NT_BIT`.
+   */
+  SYSTEM_ERROR2_CONSTEXPR20 virtual bool
+  _do_equivalent(const status_code<void> &code1,
+                 const status_code<void> &code2) const noexcept override  // NOLINT
+  {
+    assert(code1.domain() == *this);                               // NOLINT
+    const auto &c1 = static_cast<const remote_com_code &>(code1);  // NOLINT
+    if(code2.domain() == *this)
+    {
+      const auto &c2 = static_cast<const remote_com_code &>(code2);  // NOLINT
+      return c1.value() == c2.value();
+    }
+    if(code2.domain() == generic_code_domain)
+    {
+      const auto &c2 = static_cast<const generic_code &>(code2);  // NOLINT
+      const int errcode = _com_code_to_errno(c1.value());
+      if(errcode != -1 && static_cast<int>(c2.value()) == errcode)
+      {
+        return true;
+      }
+    }
+    else if(code2.domain() == remote_nt_code_domain)
+    {
+      const auto &c2 = static_cast<const remote_nt_code &>(code2);  // NOLINT
+      if(_is_nt_code(c1.value()) && static_cast<uint32_t>(c2.value()) == _nt_code(c1.value()))
+      {
+        return true;
+      }
+    }
+    else if(code2.domain() == remote_win32_code_domain)
+    {
+      const auto &c2 = static_cast<const remote_win32_code &>(code2);  // NOLINT
+      if(_is_win32_code(c1.value()) && c2.value() == _win32_code(c1.value()))
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+  SYSTEM_ERROR2_CONSTEXPR20 virtual void _do_generic_code(_vtable_generic_code_args &args) const noexcept override
+  {
+    assert(args.code.domain() == *this);                              // NOLINT
+    const auto &c = static_cast<const remote_com_code &>(args.code);  // NOLINT
+    args.ret = generic_code(static_cast<errc>(_com_code_to_errno(c.value())));
+  }
+  virtual int _do_message(_vtable_message_args &args) const noexcept override
+  {
+    assert(args.code.domain() == *this);                              // NOLINT
+    const auto &c = static_cast<const remote_com_code &>(args.code);  // NOLINT
+    char buffer[detail::remote_windows_code_message_size];
+    const size_t len = _make_message(buffer, c.value());
+    args.ret = _base::_copied_string_ref(buffer, len);
+    return 0;
+  }
+  virtual int _do_message_into(_vtable_message_into_args &args) const noexcept override  // NOLINT
+  {
+    assert(args.code.domain() == *this);                              // NOLINT
+    const auto &c = static_cast<const remote_com_code &>(args.code);  // NOLINT
+    char buffer[detail::remote_windows_code_message_size];
+    const size_t len = _make_message(buffer, c.value());
+    args.ret = _copy_string_into(args.buffer, args.length, buffer, len);
+    return 0;
+  }
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
+  SYSTEM_ERROR2_NORETURN virtual void _do_throw_exception(const status_code<void> &code) const override  // NOLINT
+  {
+    assert(code.domain() == *this);                              // NOLINT
+    const auto &c = static_cast<const remote_com_code &>(code);  // NOLINT
+    throw status_error<_remote_com_code_domain>(c);
+  }
+#endif
+};
+//! A constexpr source variable for the remote COM code domain. Returned by `_remote_com_code_domain::get()`.
+constexpr _remote_com_code_domain remote_com_code_domain;
+inline constexpr const _remote_com_code_domain &_remote_com_code_domain::get()
+{
+  return remote_com_code_domain;
+}
+
+namespace traits
+{
+  //! Remote COM codes are equivalent if their values are equal, or if they map onto the same generic code.
+  template <> struct static_equivalence<_remote_com_code_domain, _remote_com_code_domain>
+  {
+    static constexpr bool value = true;
+    static SYSTEM_ERROR2_CONSTEXPR14 bool equivalent(const remote_com_code &a, const remote_com_code &b) noexcept
+    {
+      const int errcode = _remote_com_code_domain::_com_code_to_errno(a.value());
+      return a.value() == b.value() ||
+             (errcode != -1 && errcode == _remote_com_code_domain::_com_code_to_errno(b.value()));
+    }
+  };
+  //! A remote COM code is equivalent to the generic code it maps onto.
+  template <> struct static_equivalence<_remote_com_code_domain, _generic_code_domain>
+  {
+    static constexpr bool value = true;
+    static SYSTEM_ERROR2_CONSTEXPR14 bool equivalent(const remote_com_code &a, const generic_code &b) noexcept
+    {
+      const int errcode = _remote_com_code_domain::_com_code_to_errno(a.value());
+      return errcode != -1 && static_cast<int>(b.value()) == errcode;
+    }
+  };
+}  // namespace traits
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
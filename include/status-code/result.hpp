@@ -1,4 +1,4 @@
-/* A partial result based on std::variant and proposed std::error
+/* A partial result based on proposed std::error
 (C) 2020-2026 Niall Douglas <http://www.nedproductions.biz/> (11 commits)
 File Created: Jan 2020
 
@@ -27,10 +27,10 @@ Distributed under the Boost Software License, Version 1.0.
 #include "error.hpp"
 
 #if __cplusplus >= 201703L || _HAS_CXX17
-#if __has_include(<variant>)
 
+#include <cstring>  // for memcpy
 #include <exception>
-#include <variant>
+#include <utility>  // for in_place_type_t
 
 SYSTEM_ERROR2_NAMESPACE_BEGIN
 
@@ -62,17 +62,320 @@ namespace detail
   {
   };
   template <class T> using devoid = std::conditional_t<std::is_void_v<T>, void_, T>;
+
+  // No status code domain lives at the address of this, so it can mark a `result` as having a value
+  inline constexpr char result_value_marker{};
+
+  template <class T, bool TriviallyCopyable = std::is_trivially_copyable_v<devoid<T>>> class result_storage;
+
+  /* The operations upon the storage of `result<T>`, with which `Storage`, the
+  `result_storage` holding the union of the error and the value alternatives,
+  defines its constructors and special member functions.
+
+  Rather than keep a separate discriminant, the value alternative begins with the
+  address of `result_value_marker` laid over the domain pointer of the error
+  alternative. An error, even an empty one, can never have that domain pointer,
+  so errors moved from or assigned through a reference remain errors. This keeps
+  `result<int>` and `result<void>` the same size as `error`.
+  */
+  template <class T, class Storage> class result_storage_ops
+  {
+    template <class U, class OtherStorage> friend class result_storage_ops;
+
+  protected:
+    using _value_type = devoid<T>;
+    using _error_type = SYSTEM_ERROR2_NAMESPACE::error;
+
+    struct _value_storage
+    {
+      const void *_niche{&result_value_marker};
+      _value_type _v;
+
+      template <class... Args>
+      constexpr explicit _value_storage(std::in_place_t /*unused*/, Args &&...args) noexcept(
+      std::is_nothrow_constructible_v<_value_type, Args...>)
+          : _v(static_cast<Args &&>(args)...)
+      {
+      }
+    };
+
+    struct _value_tag
+    {
+    };
+    struct _error_tag
+    {
+    };
+
+    Storage &_self() noexcept { return static_cast<Storage &>(*this); }
+    const Storage &_self() const noexcept { return static_cast<const Storage &>(*this); }
+
+    void _destroy() noexcept
+    {
+      if(_has_value())
+      {
+        _self()._value.~_value_storage();
+      }
+      else
+      {
+        _self()._error.~_error_type();
+      }
+    }
+    // Replaces whatever we hold with a value, leaving us unchanged if constructing the value throws
+    template <class... Args> void _emplace_value(Args &&...args)
+    {
+      Storage &self = _self();
+      if(_has_value())
+      {
+        self._value.~_value_storage();
+        new(&self._value) _value_storage(std::in_place, static_cast<Args &&>(args)...);
+        return;
+      }
+      if constexpr(std::is_nothrow_constructible_v<_value_type, Args...>)
+      {
+        self._error.~_error_type();
+        new(&self._value) _value_storage(std::in_place, static_cast<Args &&>(args)...);
+      }
+      else
+      {
+        // Errors move by copying bits, so this cannot throw
+        _error_type saved(static_cast<_error_type &&>(self._error));
+        self._error.~_error_type();
+#ifdef __cpp_exceptions
+        try
+#endif
+        {
+          new(&self._value) _value_storage(std::in_place, static_cast<Args &&>(args)...);
+        }
+#ifdef __cpp_exceptions
+        catch(...)
+        {
+          new(&self._error) _error_type(static_cast<_error_type &&>(saved));
+          throw;
+        }
+#endif
+      }
+    }
+    template <class U, bool B> void _move_construct_from(result_storage<U, B> &&o)
+    {
+      Storage &self = _self();
+      if(o._has_value())
+      {
+        new(&self._value)
+        _value_storage(std::in_place, static_cast<typename result_storage<U, B>::_value_type &&>(o._value._v));
+      }
+      else
+      {
+        new(&self._error) _error_type(static_cast<_error_type &&>(o._error));
+      }
+    }
+    template <class U, bool B> void _copy_construct_from(const result_storage<U, B> &o)
+    {
+      Storage &self = _self();
+      if(o._has_value())
+      {
+        new(&self._value) _value_storage(std::in_place, o._value._v);
+      }
+      else
+      {
+        new(&self._error) _error_type(o._error.clone());
+      }
+    }
+    void _move_assign_from(Storage &&o)
+    {
+      Storage &self = _self();
+      if(&self == &o)
+      {
+        return;
+      }
+      if(o._has_value())
+      {
+        if(_has_value())
+        {
+          self._value._v = static_cast<_value_type &&>(o._value._v);
+        }
+        else
+        {
+          _emplace_value(static_cast<_value_type &&>(o._value._v));
+        }
+        return;
+      }
+      _destroy();
+      new(&self._error) _error_type(static_cast<_error_type &&>(o._error));
+    }
+
+    bool _has_value() const noexcept
+    {
+      const void *domain;
+      memcpy(&domain, static_cast<const void *>(&_self()), sizeof(domain));
+      return domain == &result_value_marker;
+    }
+  };
+
+  /* The storage for `result<T>`. The special member functions live here, so
+  `result<T>` can default them and have them deleted when `T` does not support
+  them.
+
+  Relocating a `result<T>` by copying its bits is correct only if it is correct
+  for `T`, so only the edition for trivially copyable `T` below is marked
+  `[[clang::trivial_abi]]`. Otherwise passing a `result<T>` in registers would
+  change when `T` is moved and destroyed.
+  */
+  template <class T, bool TriviallyCopyable>
+  class result_storage : public result_storage_ops<T, result_storage<T, TriviallyCopyable>>
+  {
+    template <class U, bool B> friend class result_storage;
+    template <class U, class OtherStorage> friend class result_storage_ops;
+    using _ops = result_storage_ops<T, result_storage<T, TriviallyCopyable>>;
+
+  protected:
+    using typename _ops::_error_type;
+    using typename _ops::_value_storage;
+    using typename _ops::_value_type;
+    using typename _ops::_error_tag;
+    using typename _ops::_value_tag;
+
+    union
+    {
+      _error_type _error;
+      _value_storage _value;
+    };
+
+    template <class... Args>
+    constexpr explicit result_storage(_value_tag /*unused*/, Args &&...args) noexcept(
+    std::is_nothrow_constructible_v<_value_type, Args...>)
+        : _value(std::in_place, static_cast<Args &&>(args)...)
+    {
+    }
+    template <class... Args>
+    explicit result_storage(_error_tag /*unused*/, Args &&...args) noexcept(
+    std::is_nothrow_constructible_v<_error_type, Args...>)
+        : _error(static_cast<Args &&>(args)...)
+    {
+    }
+    template <class U, bool B> explicit result_storage(result_storage<U, B> &&o)
+    {
+      this->_move_construct_from(static_cast<result_storage<U, B> &&>(o));
+    }
+    template <class U, bool B> explicit result_storage(const result_storage<U, B> &o) { this->_copy_construct_from(o); }
+
+  public:
+    result_storage() = delete;
+    result_storage(const result_storage &) = delete;
+    result_storage(result_storage &&o) noexcept(std::is_nothrow_move_constructible_v<_value_type>)
+    {
+      this->_move_construct_from(static_cast<result_storage &&>(o));
+    }
+    result_storage &operator=(const result_storage &) = delete;
+    result_storage &operator=(result_storage &&o) noexcept(
+    std::is_nothrow_move_constructible_v<_value_type> &&std::is_nothrow_move_assignable_v<_value_type>)
+    {
+      this->_move_assign_from(static_cast<result_storage &&>(o));
+      return *this;
+    }
+    ~result_storage() { this->_destroy(); }
+  };
+  template <class T>
+  class SYSTEM_ERROR2_TRIVIAL_ABI result_storage<T, true> : public result_storage_ops<T, result_storage<T, true>>
+  {
+    template <class U, bool B> friend class result_storage;
+    template <class U, class OtherStorage> friend class result_storage_ops;
+    using _ops = result_storage_ops<T, result_storage<T, true>>;
+
+  protected:
+    using typename _ops::_error_type;
+    using typename _ops::_value_storage;
+    using typename _ops::_value_type;
+    using typename _ops::_error_tag;
+    using typename _ops::_value_tag;
+
+    union
+    {
+      _error_type _error;
+      _value_storage _value;
+    };
+
+    template <class... Args>
+    constexpr explicit result_storage(_value_tag /*unused*/, Args &&...args) noexcept(
+    std::is_nothrow_constructible_v<_value_type, Args...>)
+        : _value(std::in_place, static_cast<Args &&>(args)...)
+    {
+    }
+    template <class... Args>
+    explicit result_storage(_error_tag /*unused*/, Args &&...args) noexcept(
+    std::is_nothrow_constructible_v<_error_type, Args...>)
+        : _error(static_cast<Args &&>(args)...)
+    {
+    }
+    template <class U, bool B> explicit result_storage(result_storage<U, B> &&o)
+    {
+      this->_move_construct_from(static_cast<result_storage<U, B> &&>(o));
+    }
+    template <class U, bool B> explicit result_storage(const result_storage<U, B> &o) { this->_copy_construct_from(o); }
+
+  public:
+    result_storage() = delete;
+    result_storage(const result_storage &) = delete;
+    result_storage(result_storage &&o) noexcept(std::is_nothrow_move_constructible_v<_value_type>)
+    {
+      this->_move_construct_from(static_cast<result_storage &&>(o));
+    }
+    result_storage &operator=(const result_storage &) = delete;
+    result_storage &operator=(result_storage &&o) noexcept(
+    std::is_nothrow_move_constructible_v<_value_type> &&std::is_nothrow_move_assignable_v<_value_type>)
+    {
+      this->_move_assign_from(static_cast<result_storage &&>(o));
+      return *this;
+    }
+    ~result_storage() { this->_destroy(); }
+  };
+
+  // Deletes the move operations of `result<T>` when `T` lacks them
+  template <bool MoveConstructible, bool MoveAssignable> struct result_move_control
+  {
+  };
+  template <> struct result_move_control<true, false>
+  {
+    result_move_control() = default;
+    result_move_control(const result_move_control &) = default;
+    result_move_control(result_move_control &&) = default;
+    result_move_control &operator=(const result_move_control &) = default;
+    result_move_control &operator=(result_move_control &&) = delete;
+    ~result_move_control() = default;
+  };
+  template <> struct result_move_control<false, false>
+  {
+    result_move_control() = default;
+    result_move_control(const result_move_control &) = default;
+    result_move_control(result_move_control &&) = delete;
+    result_move_control &operator=(const result_move_control &) = default;
+    result_move_control &operator=(result_move_control &&) = delete;
+    ~result_move_control() = default;
+  };
 }  // namespace detail
 
 /*! \class result
-\brief A imperfect `result<T>` type with its error type hardcoded to `error`, only available on C++ 17 or later.
-
-Note that the proper `result<T>` type does not have the possibility of
-valueless by exception state. This implementation is therefore imperfect.
+\brief A `result<T>` type with its error type hardcoded to `error`, only available on C++ 17 or later.
+
+Unlike a `std::variant<error, T>`, this is never valueless. There is no separate
+discriminant: the value alternative lays the address of a marker object over the
+domain pointer of the error, so a `result<int>` or `result<void>` is the same size
+as an `error`. On clang, which alone supports `[[clang::trivial_abi]]`, it is also
+trivially relocatable if `T` is trivially copyable, and so is passed in registers.
+Otherwise, and on other compilers, it is passed in memory, as an `error` is.
+
+As with a `std::variant<error, T>`, moving the error out of a result, whether by
+moving the result or by `error() &&`, leaves behind an empty error, and the result
+continues to have an error.
 */
-template <class T> class result : protected std::variant<SYSTEM_ERROR2_NAMESPACE::error, detail::devoid<T>>
+template <class T>
+class result
+    : public detail::result_storage<T>
+    , private detail::result_move_control<std::is_move_constructible_v<detail::devoid<T>>,
+                                          std::is_move_constructible_v<detail::devoid<T>> &&
+                                          std::is_move_assignable_v<detail::devoid<T>>>
 {
-  using _base = std::variant<SYSTEM_ERROR2_NAMESPACE::error, detail::devoid<T>>;
+  using _base = detail::result_storage<T>;
+  template <class U> friend class result;
   static_assert(!std::is_reference_v<T>, "Type cannot be a reference");
   static_assert(!std::is_array_v<T>, "Type cannot be an array");
   static_assert(!std::is_same_v<T, SYSTEM_ERROR2_NAMESPACE::error>, "Type cannot be a std::error");
@@ -105,14 +408,17 @@ public:
   template <class U> using rebind = result<U>;
 
 protected:
+  using typename _base::_error_tag;
+  using typename _base::_value_tag;
+
   constexpr void _check() const
   {
-    if(_base::index() == 0)
+    if(!has_value())
     {
-      std::get_if<0>(this)->throw_exception();
+      this->_error.throw_exception();
     }
   }
-  constexpr
+  static constexpr
 #ifdef _MSC_VER
   __declspec(noreturn)
 #elif defined(__GNUC__) || defined(__clang__)
@@ -147,43 +453,76 @@ public:
 
   //! Implicit result converting move constructor
   SYSTEM_ERROR2_TEMPLATE(class U)
-  SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(std::is_convertible_v<U, T>))
+  SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(!std::is_same_v<U, T> && std::is_convertible_v<U, T>))
   constexpr result(result<U> &&o,
                    _implicit_converting_constructor_tag = {}) noexcept(std::is_nothrow_constructible_v<T, U>)
-      : _base(std::move(o))
+      : _base(static_cast<detail::result_storage<U> &&>(o))
   {
   }
   //! Implicit result converting copy constructor
   SYSTEM_ERROR2_TEMPLATE(class U)
-  SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(std::is_convertible_v<U, T>))
-  constexpr result(const result<U> &o,
-                   _implicit_converting_constructor_tag = {}) noexcept(std::is_nothrow_constructible_v<T, U>)
-      : _base(o)
+  SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(!std::is_same_v<U, T> && std::is_convertible_v<U, T>))
+  constexpr result(const result<U> &o, _implicit_converting_constructor_tag = {})
+      : _base(static_cast<const detail::result_storage<U> &>(o))
   {
   }
   //! Explicit result converting move constructor
   SYSTEM_ERROR2_TEMPLATE(class U)
-  SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(std::is_constructible_v<T, U>))
+  SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(!std::is_same_v<U, T> && !std::is_convertible_v<U, T> &&
+                                              std::is_constructible_v<T, U>))
   constexpr explicit result(result<U> &&o,
                             _explicit_converting_constructor_tag = {}) noexcept(std::is_nothrow_constructible_v<T, U>)
-      : _base(std::move(o))
+      : _base(static_cast<detail::result_storage<U> &&>(o))
   {
   }
   //! Explicit result converting copy constructor
   SYSTEM_ERROR2_TEMPLATE(class U)
-  SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(std::is_constructible_v<T, U>))
-  constexpr explicit result(const result<U> &o,
-                            _explicit_converting_constructor_tag = {}) noexcept(std::is_nothrow_constructible_v<T, U>)
-      : _base(o)
+  SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(!std::is_same_v<U, T> && !std::is_convertible_v<U, T> &&
+                                              std::is_constructible_v<T, U>))
+  constexpr explicit result(const result<U> &o, _explicit_converting_constructor_tag = {})
+      : _base(static_cast<const detail::result_storage<U> &>(o))
   {
   }
 
-  //! Anything which `std::variant<error, T>` will construct from, we shall implicitly construct from
-  using _base::_base;
+  //! Implicit converting value constructor
+  SYSTEM_ERROR2_TEMPLATE(class U)
+  SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(!is_result<std::decay_t<U>>::value &&
+                                              std::is_constructible_v<value_type_if_enabled, U> &&
+                                              !std::is_constructible_v<error_type, U>))
+  constexpr result(U &&v, _implicit_constructor_tag = {}) noexcept(
+  std::is_nothrow_constructible_v<value_type_if_enabled, U>)
+      : _base(_value_tag(), static_cast<U &&>(v))
+  {
+  }
+  //! Implicit converting error constructor
+  SYSTEM_ERROR2_TEMPLATE(class U)
+  SYSTEM_ERROR2_TREQUIRES(SYSTEM_ERROR2_TPRED(
+  !is_result<std::decay_t<U>>::value && !std::is_constructible_v<value_type_if_enabled, U> &&
+  std::is_constructible_v<error_type, U> &&
+  !is_status_code<typename detail::safe_get_make_status_code_result<U>::type>::value))  // not ADL constructed
+  constexpr result(U &&v, _implicit_constructor_tag = {}) noexcept(std::is_nothrow_constructible_v<error_type, U>)
+      : _base(_error_tag(), static_cast<U &&>(v))
+  {
+  }
+
+  //! Explicit in-place value constructor
+  template <class... Args>
+  constexpr explicit result(std::in_place_type_t<value_type_if_enabled> /*unused*/, Args &&...args) noexcept(
+  std::is_nothrow_constructible_v<value_type_if_enabled, Args...>)
+      : _base(_value_tag(), static_cast<Args &&>(args)...)
+  {
+  }
+  //! Explicit in-place error constructor
+  template <class... Args>
+  constexpr explicit result(std::in_place_type_t<error_type> /*unused*/, Args &&...args) noexcept(
+  std::is_nothrow_constructible_v<error_type, Args...>)
+      : _base(_error_tag(), static_cast<Args &&>(args)...)
+  {
+  }
 
   //! Special case `in_place_type_t<void>`
   constexpr explicit result(std::in_place_type_t<void> /*unused*/) noexcept
-      : _base(in_place_type<detail::void_>)
+      : _base(_value_tag())
   {
   }
 
@@ -194,7 +533,7 @@ public:
                                               &&std::is_constructible_v<error_type, Arg1, Arg2, Args...>))
   constexpr result(Arg1 &&arg1, Arg2 &&arg2,
                    Args &&...args) noexcept(std::is_nothrow_constructible_v<error_type, Arg1, Arg2, Args...>)
-      : _base(std::in_place_index<0>, std::forward<Arg1>(arg1), std::forward<Arg2>(arg2), std::forward<Args>(args)...)
+      : _base(_error_tag(), std::forward<Arg1>(arg1), std::forward<Arg2>(arg2), std::forward<Args>(args)...)
   {
   }
 
@@ -205,7 +544,7 @@ public:
                                               &&std::is_constructible_v<value_type, Arg1, Arg2, Args...>))
   constexpr result(Arg1 &&arg1, Arg2 &&arg2,
                    Args &&...args) noexcept(std::is_nothrow_constructible_v<value_type, Arg1, Arg2, Args...>)
-      : _base(std::in_place_index<1>, std::forward<Arg1>(arg1), std::forward<Arg2>(arg2), std::forward<Args>(args)...)
+      : _base(_value_tag(), std::forward<Arg1>(arg1), std::forward<Arg2>(arg2), std::forward<Args>(args)...)
   {
   }
 
@@ -221,46 +560,52 @@ public:
   && std::is_constructible<error_type, MakeStatusCodeResult>::value))  // ADLed status code is compatible
   constexpr result(U &&v, Args &&...args) noexcept(noexcept(make_status_code(std::declval<U>(),
                                                                              std::declval<Args>()...)))  // NOLINT
-      : _base(std::in_place_index<0>, make_status_code(static_cast<U &&>(v), static_cast<Args &&>(args)...))
+      : _base(_error_tag(), make_status_code(static_cast<U &&>(v), static_cast<Args &&>(args)...))
   {
   }
 
   //! Swap with another result
-  constexpr void swap(result &o) noexcept(std::is_nothrow_swappable_v<_base>) { _base::swap(o); }
+  constexpr void swap(result &o) noexcept(std::is_nothrow_move_constructible_v<value_type_if_enabled>
+                                          &&std::is_nothrow_move_assignable_v<value_type_if_enabled>)
+  {
+    result temp(static_cast<result &&>(o));
+    o = static_cast<result &&>(*this);
+    *this = static_cast<result &&>(temp);
+  }
 
   //! Clone the result
   constexpr result clone() const { return has_value() ? result(value()) : result(error().clone()); }
 
   //! True if result has a value
-  constexpr bool has_value() const noexcept { return _base::index() == 1; }
+  constexpr bool has_value() const noexcept { return this->_has_value(); }
   //! True if result has a value
   explicit operator bool() const noexcept { return has_value(); }
   //! True if result has an error
-  constexpr bool has_error() const noexcept { return _base::index() == 0; }
+  constexpr bool has_error() const noexcept { return !this->_has_value(); }
 
   //! Accesses the value if one exists, else calls `.error().throw_exception()`.
   constexpr value_type_if_enabled &value() &
   {
     _check();
-    return std::get<1>(*this);
+    return this->_value._v;
   }
   //! Accesses the value if one exists, else calls `.error().throw_exception()`.
   constexpr const value_type_if_enabled &value() const &
   {
     _check();
-    return std::get<1>(*this);
+    return this->_value._v;
   }
   //! Accesses the value if one exists, else calls `.error().throw_exception()`.
   constexpr value_type_if_enabled &&value() &&
   {
     _check();
-    return std::get<1>(std::move(*this));
+    return static_cast<value_type_if_enabled &&>(this->_value._v);
   }
   //! Accesses the value if one exists, else calls `.error().throw_exception()`.
   constexpr const value_type_if_enabled &&value() const &&
   {
     _check();
-    return std::get<1>(std::move(*this));
+    return static_cast<const value_type_if_enabled &&>(this->_value._v);
   }
 
   //! Accesses the error if one exists, else throws `bad_result_access`.
@@ -274,7 +619,7 @@ public:
       abort();
 #endif
     }
-    return *std::get_if<0>(this);
+    return this->_error;
   }
   //! Accesses the error if one exists, else throws `bad_result_access`.
   constexpr const error_type &error() const &
@@ -287,7 +632,7 @@ public:
       abort();
 #endif
     }
-    return *std::get_if<0>(this);
+    return this->_error;
   }
   //! Accesses the error if one exists, else throws `bad_result_access`.
   constexpr error_type &&error() &&
@@ -300,7 +645,7 @@ public:
       abort();
 #endif
     }
-    return std::move(*std::get_if<0>(this));
+    return static_cast<error_type &&>(this->_error);
   }
   //! Accesses the error if one exists, else throws `bad_result_access`.
   constexpr const error_type &&error() const &&
@@ -313,7 +658,7 @@ public:
       abort();
 #endif
     }
-    return std::move(*std::get_if<0>(this));
+    return static_cast<const error_type &&>(this->_error);
   }
 
   //! Accesses the value, being UB if none exists
@@ -323,7 +668,7 @@ public:
     {
       _ub();
     }
-    return *std::get_if<1>(this);
+    return this->_value._v;
   }
   //! Accesses the error, being UB if none exists
   constexpr const value_type_if_enabled &assume_value() const & noexcept
@@ -332,7 +677,7 @@ public:
     {
       _ub();
     }
-    return *std::get_if<1>(this);
+    return this->_value._v;
   }
   //! Accesses the error, being UB if none exists
   constexpr value_type_if_enabled &&assume_value() && noexcept
@@ -341,7 +686,7 @@ public:
     {
       _ub();
     }
-    return std::move(*std::get_if<1>(this));
+    return static_cast<value_type_if_enabled &&>(this->_value._v);
   }
   //! Accesses the error, being UB if none exists
   constexpr const value_type_if_enabled &&assume_value() const && noexcept
@@ -350,7 +695,7 @@ public:
     {
       _ub();
     }
-    return std::move(*std::get_if<1>(this));
+    return static_cast<const value_type_if_enabled &&>(this->_value._v);
   }
 
   //! Accesses the error, being UB if none exists
@@ -360,7 +705,7 @@ public:
     {
       _ub();
     }
-    return *std::get_if<0>(this);
+    return this->_error;
   }
   //! Accesses the error, being UB if none exists
   constexpr const error_type &assume_error() const & noexcept
@@ -369,7 +714,7 @@ public:
     {
       _ub();
     }
-    return *std::get_if<0>(this);
+    return this->_error;
   }
   //! Accesses the error, being UB if none exists
   constexpr error_type &&assume_error() && noexcept
@@ -378,7 +723,7 @@ public:
     {
       _ub();
     }
-    return std::move(*std::get_if<0>(this));
+    return static_cast<error_type &&>(this->_error);
   }
   //! Accesses the error, being UB if none exists
   constexpr const error_type &&assume_error() const && noexcept
@@ -387,7 +732,7 @@ public:
     {
       _ub();
     }
-    return std::move(*std::get_if<0>(this));
+    return static_cast<const error_type &&>(this->_error);
   }
 };
 
@@ -395,19 +740,20 @@ public:
 template <class T, class U, typename = decltype(std::declval<T>() == std::declval<U>())>
 constexpr inline bool operator==(const result<T> &a, const result<U> &b) noexcept
 {
-  const auto &x = a._internal();
-  return x == b;
+  if(a.has_value() != b.has_value())
+  {
+    return false;
+  }
+  return a.has_value() ? (a.assume_value() == b.assume_value()) : (a.assume_error() == b.assume_error());
 }
 //! True if the two results compare unequal.
 template <class T, class U, typename = decltype(std::declval<T>() != std::declval<U>())>
 constexpr inline bool operator!=(const result<T> &a, const result<U> &b) noexcept
 {
-  const auto &x = a._internal();
-  return x != b;
+  return !(a == b);
 }
 
 SYSTEM_ERROR2_NAMESPACE_END
 
 #endif
 #endif
-#endif
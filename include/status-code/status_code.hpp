@@ -27,6 +27,20 @@ http://www.boost.org/LICENSE_1_0.txt)
 
 #include "status_code_domain.hpp"
 
+#ifndef SYSTEM_ERROR2_ENABLE_TELEMETRY
+/*! If true, every type erased status code constructed from a typed status code which
+is a failure is counted by its domain id and value. See "telemetry.hpp". Erasure is
+then no longer `constexpr`. Defaults to false.
+*/
+#define SYSTEM_ERROR2_ENABLE_TELEMETRY 0
+#endif
+#if SYSTEM_ERROR2_ENABLE_TELEMETRY
+#include "telemetry.hpp"
+#define SYSTEM_ERROR2_TELEMETRY_CONSTEXPR
+#else
+#define SYSTEM_ERROR2_TELEMETRY_CONSTEXPR constexpr
+#endif
+
 #if (__cplusplus >= 201700 || _HAS_CXX17) && !defined(SYSTEM_ERROR2_DISABLE_STD_IN_PLACE)
 // 0.26
 #include <utility>  // for in_place
@@ -316,15 +330,34 @@ public:
     }
     return string_ref("(empty)");
   }
+  /*! Writes the string textually representing the code into the `length` bytes at
+  `buffer`, truncated if need be and null terminated if `length` is not zero, returning
+  the number of characters written. The POSIX, `std::error_code`, `boost::system::error_code`,
+  `getaddrinfo()` and nested domains, and the domains whose messages are string literals,
+  write their messages without allocating memory, so this is usable where allocating is
+  not wanted. It is not async signal safe: the POSIX domain's first use initialises a
+  function local static table of messages, and it and the other domains call into the C
+  and C++ runtimes, such as `strerror_r()`. Any error from the domain is ignored.
+  */
+  size_t message_into(char *buffer, size_t length) const noexcept
+  {
+    if(_domain != nullptr)
+    {
+      status_code_domain::_vtable_message_into_args args{buffer, length, *this};
+      (void) _domain->_do_message_into(args);
+      return args.ret;
+    }
+    return status_code_domain::_copy_string_into(buffer, length, "(empty)", 7);
+  }
   //! True if code means success.
   SYSTEM_ERROR2_CONSTEXPR20 bool success() const noexcept
   {
-    return (_domain != nullptr) ? !_domain->_do_failure(*this) : false;
+    return (_domain != nullptr) ? !_domain->_failure(*this) : false;
   }
   //! True if code means failure.
   SYSTEM_ERROR2_CONSTEXPR20 bool failure() const noexcept
   {
-    return (_domain != nullptr) ? _domain->_do_failure(*this) : false;
+    return (_domain != nullptr) ? _domain->_failure(*this) : false;
   }
   /*! True if code is strictly (and potentially non-transitively) semantically equivalent to another code in another
   domain. Note that usually non-semantic i.e. pure value comparison is used when the other status code has the same
@@ -350,6 +383,13 @@ public:
   for the equivalent generic code and those are compared.
   */
   template <class T> SYSTEM_ERROR2_CONSTEXPR14 inline bool equivalent(const status_code<T> &o) const noexcept;
+  /*! As `equivalent()`, but the result is memoised in a small, bounded, per-thread cache keyed by the domain
+  id and value of both codes, so repeatedly comparing the same pair costs a single hash probe. Only codes whose
+  domains describe an integral value via `status_code_domain::value_info()` are cached, all others are passed
+  through to `equivalent()`. The domains of cached codes must not make equivalence depend upon anything other
+  than their unique id and value.
+  */
+  template <class T> inline bool cached_equivalent(const status_code<T> &o) const noexcept;
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
   //! Throw a code as a C++ exception.
   SYSTEM_ERROR2_NORETURN void throw_exception() const
@@ -617,6 +657,18 @@ namespace traits
   {
     static constexpr bool value = is_move_bitcopying<typename DomainType::value_type>::value;
   };
+
+  /*! Specialise to compare `status_code<DomainType1>` with `status_code<DomainType2>` at compile
+  time. A specialisation sets `value` to true and provides a static function
+  `bool equivalent(const status_code<DomainType1> &, const status_code<DomainType2> &) noexcept`,
+  which is only ever passed non-empty codes and must agree with `status_code<void>::equivalent()`.
+  `operator==` and `operator!=` between codes of those domains, in either order, then call it
+  instead of the virtual functions of the domains. Erased codes always use `equivalent()`.
+  */
+  template <class DomainType1, class DomainType2> struct static_equivalence
+  {
+    static constexpr bool value = false;
+  };
 }  // namespace traits
 
 
@@ -685,6 +737,18 @@ protected:
   struct _nonerased_to_erased_tag
   {
   };
+#if SYSTEM_ERROR2_ENABLE_TELEMETRY
+  // Counts this code with telemetry if it is a failure
+  void _telemetry_record() const noexcept
+  {
+    if(this->_domain != nullptr && this->_domain->_failure(*this))
+    {
+      long long value = 0;
+      (void) this->_domain->_load_integral_value(value, *this);
+      detail::telemetry_record(this->_domain->id(), value);
+    }
+  }
+#endif
 
 public:
   constexpr status_code(_nonerased_to_erased_tag, const _base &o)
@@ -699,9 +763,13 @@ public:
   SYSTEM_ERROR2_TREQUIRES(
   SYSTEM_ERROR2_TPRED(detail::domain_value_type_erasure_is_safe<detail::erased<ErasedType>, DomainType>::value),
   SYSTEM_ERROR2_TPRED(!detail::is_erased_status_code<status_code<typename std::decay<DomainType>::type>>::value))
-  constexpr status_code(_nonerased_to_erased_tag, const status_code<DomainType> &v) noexcept  // NOLINT
+  SYSTEM_ERROR2_TELEMETRY_CONSTEXPR status_code(_nonerased_to_erased_tag,
+                                                const status_code<DomainType> &v) noexcept  // NOLINT
       : _base(typename _base::_value_type_constructor{}, v._domain_ptr(), detail::erasure_cast<value_type>(v.value()))
   {
+#if SYSTEM_ERROR2_ENABLE_TELEMETRY
+    _telemetry_record();
+#endif
   }
   SYSTEM_ERROR2_TEMPLATE(class DomainType)  //
   SYSTEM_ERROR2_TREQUIRES(
@@ -714,6 +782,9 @@ public:
     // deliberately do not destruct value moved into buffer
     (void) buffer;
     v._domain = nullptr;
+#if SYSTEM_ERROR2_ENABLE_TELEMETRY
+    _telemetry_record();
+#endif
   }
 
 public:
@@ -45,10 +45,11 @@ SYSTEM_ERROR2_NAMESPACE_BEGIN
 Be careful of placing these into containers! Equality and inequality operators are
 *semantic* not exact. Therefore two distinct items will test true! To help prevent
 surprise on this, `operator<` and `std::hash<>` are NOT implemented in order to
-trap potential incorrectness. Define your own custom comparison functions for your
-container which perform exact comparisons.
+trap potential incorrectness. Use `exact_hash` and `exact_equal` from `status_code_map.hpp`
+for your container, which perform exact comparisons.
 */
 template <class DomainType> class status_code;
+enum class errc : int;
 class _generic_code_domain;
 //! The generic code is a status code with the generic code domain, which is that of `errc` (POSIX).
 using generic_code = status_code<_generic_code_domain>;
@@ -58,6 +59,23 @@ namespace detail
   SYSTEM_ERROR2_CONSTEXPR20 inline void generic_code_check_throw(int errcode);
 
   template <class StatusCode, class Allocator> class indirecting_domain;
+  struct status_code_domain_access;
+
+  /* The arena, if any, into which the calling thread's dynamically rendered
+  message strings are copied. Installed only for the duration of a call to
+  `message(const status_code<void> &, message_arena &)`.
+  */
+  struct message_arena_hook
+  {
+    void *arena;
+    char *(*allocate)(void *arena, size_t bytes);
+  };
+  inline message_arena_hook &current_message_arena() noexcept
+  {
+    static thread_local message_arena_hook v;
+    return v;
+  }
+
   /* We are severely limited by needing to retain C++ 11 compatibility when doing
   constexpr string parsing. MSVC lets you throw exceptions within a constexpr
   evaluation context when exceptions are globally disabled, but won't let you
@@ -124,6 +142,7 @@ class status_code_domain
 {
   template <class DomainType> friend class status_code;
   template <class StatusCode, class Allocator> friend class detail::indirecting_domain;
+  friend struct detail::status_code_domain_access;
 
 public:
   //! Type of the unique id for this domain.
@@ -145,6 +164,112 @@ public:
     }
   };
 
+  /*! Describes how codes of this domain store their value, so that some operations upon
+  type erased codes can be performed without calling into the domain.
+
+  If a domain's value is an integer or enumeration, `size` is its size in bytes and
+  `offset` its byte offset from the start of the status code. If `failure` is not
+  `failure_kind::opaque`, `failure()` and `success()` upon a type erased code compare
+  that value directly and do not call the virtual function `_do_failure()`. A domain
+  whose `_do_failure()` cannot be so expressed must use `failure_kind::opaque`, which is
+  the default. The built in domains describe their values only when constructed with
+  their own unique id, see `_own_value_info()`, so a domain derived from one of them
+  which overrides `_do_failure()` or `_do_generic_code()` is honoured unless it passes a
+  `value_info_t` of its own.
+
+  If `generic_size` is not zero, the generic code of a value within the `generic_size`
+  values from `generic_first` is `generic_table[value - generic_first]`, or the value
+  itself if `generic_table` is null, and `equivalent()` looks it up there rather than
+  calling the virtual function `_do_generic_code()`. This table must agree with
+  `_do_generic_code()`.
+  */
+  struct value_info_t
+  {
+    //! How failure is determined from the value
+    enum class failure_kind : unsigned char
+    {
+      opaque,         //!< Only `_do_failure()` can say
+      nonzero,        //!< Any value other than zero is a failure
+      greater_equal,  //!< Any value greater than or equal to `threshold` is a failure
+      less            //!< Any value less than `threshold` is a failure
+    };
+
+    unsigned char size{0};                       //!< The value size in bytes, or zero if not integral
+    unsigned char offset{0};                     //!< The value offset in bytes from the start of the status code
+    bool is_signed{false};                       //!< True if the value is signed
+    failure_kind failure{failure_kind::opaque};  //!< How failure is determined from the value
+    long long threshold{0};                      //!< The threshold for `greater_equal` and `less`
+    long long generic_first{0};                  //!< The first value mapped by `generic_table`
+    unsigned long long generic_size{0};          //!< The number of values mapped by `generic_table`
+    const errc *generic_table{nullptr};          //!< The generic code of each value, or null if the value itself
+
+    /* Precomputed so that loading the value is `(((raw & _mask) ^ _sign) - _sign)`, and
+    failure is `((value ^ _bias) >= _threshold_key) != _invert`, both without branches.
+    */
+    unsigned long long _mask{0};
+    unsigned long long _sign{0};
+    unsigned long long _bias{0};
+    unsigned long long _threshold_key{0};
+    bool _invert{false};
+
+    value_info_t() = default;
+    constexpr value_info_t(unsigned char _size, unsigned char _offset, bool _is_signed, failure_kind _failure,
+                           long long _threshold)
+        : size(_size)
+        , offset(_offset)
+        , is_signed(_is_signed)
+        , failure(_failure)
+        , threshold(_threshold)
+        , _mask((_size >= 8) ? ~0ULL : ((1ULL << (8U * _size)) - 1))
+        , _sign((_is_signed && _size > 0) ? (1ULL << (8U * _size - 1)) : 0)
+        , _bias((_is_signed && _failure != failure_kind::nonzero) ? (1ULL << 63U) : 0)
+        , _threshold_key((_failure == failure_kind::nonzero) ?
+                         1 :
+                         (static_cast<unsigned long long>(_threshold) ^
+                          ((_is_signed && _failure != failure_kind::nonzero) ? (1ULL << 63U) : 0)))
+        , _invert(_failure == failure_kind::less)
+    {
+    }
+    //! Constructs a copy of `o` which maps the generic codes of `_generic_size` values from `_generic_first`.
+    constexpr value_info_t(const value_info_t &o, long long _generic_first, unsigned long long _generic_size,
+                           const errc *_generic_table)
+        : size(o.size)
+        , offset(o.offset)
+        , is_signed(o.is_signed)
+        , failure(o.failure)
+        , threshold(o.threshold)
+        , generic_first(_generic_first)
+        , generic_size((o.size != 0) ? _generic_size : 0)
+        , generic_table(_generic_table)
+        , _mask(o._mask)
+        , _sign(o._sign)
+        , _bias(o._bias)
+        , _threshold_key(o._threshold_key)
+        , _invert(o._invert)
+    {
+    }
+
+    /*! Returns a copy mapping the generic codes of the `size` values from `first` by `table`, or
+    to the value itself if `table` is null.
+    */
+    constexpr value_info_t with_generic_code_table(long long first, unsigned long long size,
+                                                   const errc *table = nullptr) const noexcept
+    {
+      return value_info_t(*this, first, size, table);
+    }
+    //! Returns a copy mapping the generic code of every value to the value itself.
+    constexpr value_info_t with_generic_code_identity() const noexcept
+    {
+      return value_info_t(*this, static_cast<long long>(0ULL - _sign), (_mask == ~0ULL) ? ~0ULL : (_mask + 1),
+                          nullptr);
+    }
+    //! Returns a copy describing only where the value is, leaving failure and generic codes to the virtual functions.
+    constexpr value_info_t layout_only() const noexcept
+    {
+      return value_info_t(size, offset, is_signed, failure_kind::opaque, 0);
+    }
+  };
+
   /*! (Potentially thread safe) Reference to a message string.
 
   Be aware that you cannot add payload to implementations of this class.
@@ -424,8 +549,160 @@ public:
     }
   };
 
+  /*! A reference to a message string kept in a `message_arena`. There is no
+  thunk, so copies and moves cost nothing, but no copy may outlive the release
+  of the arena.
+   */
+  class arena_string_ref : public string_ref
+  {
+  public:
+    //! Construct from a null terminated string of `len` characters already within an arena.
+    arena_string_ref(const char *str, size_type len) noexcept
+        : string_ref(str, len, nullptr, nullptr, nullptr, nullptr)
+    {
+    }
+  };
+
+  /*! A reference to a short message string kept within the reference itself,
+  in the space otherwise used for state. Copies and moves point their character
+  range at their own copy of the string, so no memory is ever allocated.
+   */
+  class inline_string_ref : public string_ref
+  {
+    char *_buffer() noexcept { return reinterpret_cast<char *>(this->_state); }  // NOLINT
+
+    static int _inline_string_thunk(const _thunk_args &args) noexcept
+    {
+      auto dest = static_cast<inline_string_ref *>(args.dest);      // NOLINT
+      auto src = static_cast<const inline_string_ref *>(args.src);  // NOLINT
+      assert(dest->_thunk == _inline_string_thunk);                   // NOLINT
+      assert(src == nullptr || src->_thunk == _inline_string_thunk);  // NOLINT
+      switch(args.op)
+      {
+      case _thunk_op::copy:
+      case _thunk_op::move:
+      {
+        // The characters were copied along with the state, but the range still points into src
+        assert(src);  // NOLINT
+        const auto len = src->size();
+        dest->_begin = dest->_buffer();
+        dest->_end = dest->_begin + len;
+        return 0;
+      }
+      case _thunk_op::destruct:
+        return 0;
+      }
+      return 0;
+    }
+
+  public:
+    //! The maximum number of characters which can be kept inline
+    static constexpr size_type max_size() noexcept { return sizeof(inline_string_ref::_state) - 1; }
+
+    //! Construct from a C string, of which at most `max_size()` characters are kept.
+    explicit inline_string_ref(const char *str, size_type len = static_cast<size_type>(-1)) noexcept
+        : string_ref(_inline_string_thunk)
+    {
+      if(len == static_cast<size_type>(-1))
+      {
+        len = detail::cstrlen(str);
+      }
+      if(len > max_size())
+      {
+        len = max_size();
+      }
+      char *msg = _buffer();
+      memcpy(msg, str, len);
+      msg[len] = 0;
+      this->_begin = msg;
+      this->_end = msg + len;
+    }
+  };
+
 private:
   unique_id_type _id;
+  value_info_t _value_info;
+
+  // Loads the value described by `info`, sign extending it if it is signed
+  static unsigned long long _load_value(const char *p, const value_info_t &info) noexcept
+  {
+    unsigned long long raw;
+    if(SYSTEM_ERROR2_LITTLE_ENDIAN && sizeof(status_code_domain *) >= sizeof(raw))
+    {
+      /* The value follows the domain pointer, and the status code is padded to pointer
+      alignment, so there are always eight bytes to read. On little endian targets the
+      value is in the low bytes, and any trailing padding bytes read are masked off.
+      */
+      memcpy(&raw, p, sizeof(raw));
+    }
+    else
+    {
+      switch(info.size)
+      {
+      case 1:
+      {
+        unsigned char v;
+        memcpy(&v, p, sizeof(v));
+        raw = v;
+        break;
+      }
+      case 2:
+      {
+        unsigned short v;
+        memcpy(&v, p, sizeof(v));
+        raw = v;
+        break;
+      }
+      case 4:
+      {
+        unsigned v;
+        memcpy(&v, p, sizeof(v));
+        raw = v;
+        break;
+      }
+      default:
+        memcpy(&raw, p, sizeof(raw));
+        break;
+      }
+    }
+    return ((raw & info._mask) ^ info._sign) - info._sign;
+  }
+  /* Stores `value`, sign extended if it is signed, as the value described by `info`. As
+  with erasure into a `system_code`, on little endian targets the whole word is stored,
+  else just the value's bytes.
+  */
+  static void _store_value(char *p, const value_info_t &info, unsigned long long value) noexcept
+  {
+    if(SYSTEM_ERROR2_LITTLE_ENDIAN && sizeof(status_code_domain *) >= sizeof(value))
+    {
+      memcpy(p, &value, sizeof(value));
+      return;
+    }
+    switch(info.size)
+    {
+    case 1:
+    {
+      const auto v = static_cast<unsigned char>(value);
+      memcpy(p, &v, sizeof(v));
+      break;
+    }
+    case 2:
+    {
+      const auto v = static_cast<unsigned short>(value);
+      memcpy(p, &v, sizeof(v));
+      break;
+    }
+    case 4:
+    {
+      const auto v = static_cast<unsigned>(value);
+      memcpy(p, &v, sizeof(v));
+      break;
+    }
+    default:
+      memcpy(p, &value, sizeof(value));
+      break;
+    }
+  }
 
 protected:
   /*! Use
@@ -438,6 +715,12 @@ protected:
       : _id(id)
   {
   }
+  //! \overload
+  constexpr status_code_domain(unique_id_type id, value_info_t value_info) noexcept
+      : _id(id)
+      , _value_info(value_info)
+  {
+  }
   /*! UUID constructor, where input is constexpr parsed into a `unique_id_type`.
    */
   template <size_t N>
@@ -445,6 +728,13 @@ protected:
       : _id(detail::parse_uuid_from_array<N>(uuid))
   {
   }
+  //! \overload
+  template <size_t N>
+  constexpr status_code_domain(const char (&uuid)[N], value_info_t value_info) noexcept
+      : _id(detail::parse_uuid_from_array<N>(uuid))
+      , _value_info(value_info)
+  {
+  }
   template <size_t N> struct _uuid_size
   {
   };
@@ -454,6 +744,39 @@ protected:
       : _id(detail::parse_uuid_from_pointer<N>(uuid))
   {
   }
+  //! \overload
+  template <size_t N>
+  constexpr status_code_domain(const char *uuid, _uuid_size<N> /*unused*/, value_info_t value_info) noexcept
+      : _id(detail::parse_uuid_from_pointer<N>(uuid))
+      , _value_info(value_info)
+  {
+  }
+  /*! Returns `value_info` if `id` is `own_id`, the unique id of the domain describing its values
+  by `value_info`, else only the layout of the value. A domain derived from that domain may
+  override `_do_failure()` or `_do_generic_code()`, so what a domain says of its values is only
+  used for the domain itself, unless a derived domain opts in by passing a `value_info_t`.
+  */
+  static constexpr value_info_t _own_value_info(unique_id_type id, unique_id_type own_id,
+                                                const value_info_t &value_info) noexcept
+  {
+    return (id == own_id) ? value_info : value_info.layout_only();
+  }
+  /*! Returns a `value_info_t` for a domain whose `value_type` is `T`. If `T` is not an integer
+  nor enumeration, returns a default `value_info_t`.
+  */
+  template <class T>
+  static constexpr value_info_t _make_value_info(typename value_info_t::failure_kind failure =
+                                                 value_info_t::failure_kind::opaque,
+                                                 long long threshold = 0) noexcept
+  {
+    return (std::is_integral<T>::value || std::is_enum<T>::value) ?
+           value_info_t(static_cast<unsigned char>(sizeof(T)),
+                        static_cast<unsigned char>((sizeof(status_code_domain *) + alignof(T) - 1) / alignof(T) *
+                                                   alignof(T)),
+                        std::is_signed<typename detail::identity_or_underlying_type<T>::type>::value, failure,
+                        threshold) :
+           value_info_t();
+  }
   //! No public copying at type erased level
   status_code_domain(const status_code_domain &) = default;
   //! No public moving at type erased level
@@ -506,6 +829,22 @@ protected:
     }
   };
 
+  //! \brief The arguments for `message_into()`
+  struct _vtable_message_into_args
+  {
+    size_t ret{0};  // characters written, excluding the null terminator
+    char *buffer{nullptr};
+    size_t length{0};
+    const status_code<void> &code;
+
+    constexpr _vtable_message_into_args(char *_buffer, size_t _length, const status_code<void> &_code)
+        : buffer(_buffer)
+        , length(_length)
+        , code(_code)
+    {
+    }
+  };
+
 public:
   //! True if the unique ids match.
   constexpr bool operator==(const status_code_domain &o) const noexcept { return _id == o._id; }
@@ -516,6 +855,8 @@ public:
 
   //! Returns the unique id used to identify identical category instances.
   constexpr unique_id_type id() const noexcept { return _id; }
+  //! Returns how codes of this domain store their value.
+  constexpr const value_info_t &value_info() const noexcept { return _value_info; }
   //! Name of this category.
   SYSTEM_ERROR2_CONSTEXPR20 string_ref name() const noexcept
   {
@@ -597,9 +938,105 @@ protected:
     (void) code;
     (void) info;
   }
+  /* Write a string textually representing a code into the `length` bytes at `buffer`, truncating if need be
+  and null terminating if `length` is not zero. Default implementation copies from `_do_message()`. Override
+  to render without allocating memory nor taking locks. Placed after the other slots to keep their layout.
+  */
+  virtual int _do_message_into(_vtable_message_into_args &args) const noexcept
+  {
+    _vtable_message_args args2{{}, args.code};
+    const int ret = _do_message(args2);
+    args.ret = _copy_string_into(args.buffer, args.length, args2.ret.data(), args2.ret.size());
+    return ret;
+  }
 
   SYSTEM_ERROR2_CONSTEXPR20 inline generic_code _generic_code(const status_code<void> &code) const noexcept;
 
+  //! True if the integral value of `code` could be loaded into `out`.
+  bool _load_integral_value(long long &out, const status_code<void> &code) const noexcept
+  {
+    if(_value_info.size == 0)
+    {
+      return false;
+    }
+    const char *p = reinterpret_cast<const char *>(&code) + _value_info.offset;  // NOLINT
+    out = static_cast<long long>(_load_value(p, _value_info));
+    return true;
+  }
+  /*! Writes into `image`, which is `bytes` bytes of zeroed storage aligned as a status code,
+  a status code of this domain whose integral value is `value`. This is the inverse of
+  `_load_integral_value()`, and works whatever the endianness of the target. False if this
+  domain's value is not integral or does not fit.
+  */
+  bool _store_integral_value(void *image, size_t bytes, long long value) const noexcept
+  {
+    const size_t stored = (SYSTEM_ERROR2_LITTLE_ENDIAN && sizeof(status_code_domain *) >= sizeof(long long)) ?
+                          sizeof(long long) :
+                          _value_info.size;
+    if(_value_info.size == 0 || _value_info.offset + stored > bytes)
+    {
+      return false;
+    }
+    const status_code_domain *self = this;
+    memcpy(image, &self, sizeof(self));
+    _store_value(static_cast<char *>(image) + _value_info.offset, _value_info, static_cast<unsigned long long>(value));
+    return true;
+  }
+  // Implements `status_code<void>::failure()`, avoiding the virtual function call when the domain permits
+  SYSTEM_ERROR2_CONSTEXPR20 bool _failure(const status_code<void> &code) const noexcept
+  {
+    if(_value_info.failure != value_info_t::failure_kind::opaque && !detail::is_constant_evaluated())
+    {
+      const char *p = reinterpret_cast<const char *>(&code) + _value_info.offset;  // NOLINT
+      const unsigned long long v = _load_value(p, _value_info);
+      return ((v ^ _value_info._bias) >= _value_info._threshold_key) != _value_info._invert;
+    }
+    return _do_failure(code);
+  }
+  /*! Returns a reference to a copy of a string. This is kept in the `message_arena`
+  passed to `message(message_arena &)` if within such a call, else inline if short
+  enough, else reference counted on the heap.
+  */
+  static string_ref _copied_string_ref(const char *str, size_t len = static_cast<size_t>(-1)) noexcept
+  {
+    if(len == static_cast<size_t>(-1))
+    {
+      len = detail::cstrlen(str);
+    }
+    const auto &arena = detail::current_message_arena();
+    if(arena.allocate != nullptr)
+    {
+      if(char *p = arena.allocate(arena.arena, len + 1))
+      {
+        memcpy(p, str, len);
+        p[len] = 0;
+        return arena_string_ref(p, len);
+      }
+    }
+    if(len <= inline_string_ref::max_size())
+    {
+      return inline_string_ref(str, len);
+    }
+    return atomic_refcounted_string_ref(str, len);
+  }
+  //! Copies as much of a string as fits, null terminated, into a buffer, returning the characters copied.
+  static size_t _copy_string_into(char *buffer, size_t length, const char *str, size_t len) noexcept
+  {
+    if(length == 0)
+    {
+      return 0;
+    }
+    if(len >= length)
+    {
+      len = length - 1;
+    }
+    if(len != 0)
+    {
+      memcpy(buffer, str, len);
+    }
+    buffer[len] = 0;
+    return len;
+  }
   SYSTEM_ERROR2_CONSTEXPR20 string_ref _message(const status_code<void> &code) const
   {
     _vtable_message_args args{{}, code};
@@ -609,6 +1046,47 @@ protected:
   }
 };
 
+namespace detail
+{
+  /*! \brief The access of the add-ons of this library, such as `packed_status_code`, the
+  wire format and `status_error`, to the protected value accessors and message rendering
+  of domains. Only this is befriended by `status_code_domain`.
+  */
+  struct status_code_domain_access
+  {
+    //! True if the integral value of `code`, whose domain is `domain`, could be loaded into `out`.
+    static bool load_integral_value(const status_code_domain &domain, long long &out,
+                                    const status_code<void> &code) noexcept
+    {
+      return domain._load_integral_value(out, code);
+    }
+    /*! Writes into `image`, which is `bytes` bytes of zeroed storage aligned as a status code,
+    a status code of `domain` whose integral value is `value`. False if the value of `domain`
+    is not integral or does not fit.
+    */
+    static bool store_integral_value(const status_code_domain &domain, void *image, size_t bytes,
+                                     long long value) noexcept
+    {
+      return domain._store_integral_value(image, bytes, value);
+    }
+    /*! Renders the message of `code`, whose domain is `domain`, into `out`, returning the
+    error code of the domain's failure to render it, or zero. Unlike `status_code::message()`,
+    a failure does not terminate the program.
+    */
+    static int message(const status_code_domain &domain, status_code_domain::string_ref &out,
+                       const status_code<void> &code) noexcept
+    {
+      status_code_domain::_vtable_message_args args{{}, code};
+      const int ret = domain._do_message(args);
+      if(ret == 0)
+      {
+        out = static_cast<status_code_domain::string_ref &&>(args.ret);
+      }
+      return ret;
+    }
+  };
+}  // namespace detail
+
 SYSTEM_ERROR2_NAMESPACE_END
 
 #ifdef _MSC_VER
@@ -0,0 +1,393 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_STATUS_CODE_MAP_HPP
+#define SYSTEM_ERROR2_STATUS_CODE_MAP_HPP
+
+#include "system_code.hpp"
+
+#include <cstring>   // for memcmp
+#include <iterator>  // for forward_iterator_tag
+#include <utility>   // for pair
+#include <vector>
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+namespace detail
+{
+  /* The exact identity of a status code, being its domain's unique id and its
+  integral value if its domain says it has one, else the bytes of its payload.
+  */
+  struct exact_status_code
+  {
+    status_code_domain::unique_id_type id{0};  // zero if empty, as domain ids cannot be zero
+    long long value{0};
+    const unsigned char *bytes{nullptr};
+    size_t size{0};
+
+    explicit exact_status_code(const status_code<void> &code) noexcept
+    {
+      if(code.empty())
+      {
+        return;
+      }
+      const status_code_domain &domain = code.domain();
+      id = domain.id();
+      if(!detail::status_code_domain_access::load_integral_value(domain, value, code))
+      {
+        /* The payload follows the domain pointer, padded to its alignment, which cannot
+        exceed the alignment of the whole status code.
+        */
+        const status_code_domain::payload_info_t info = domain.payload_info();
+        const size_t offset = (info.total_alignment > sizeof(status_code<void>)) ? info.total_alignment :
+                                                                                    sizeof(status_code<void>);
+        bytes = reinterpret_cast<const unsigned char *>(&code) + offset;  // NOLINT
+        size = info.payload_size;
+      }
+    }
+
+    size_t hash() const noexcept
+    {
+      unsigned long long x = static_cast<unsigned long long>(value);
+      for(size_t n = 0; n < size; n++)
+      {
+        // FNV-1a
+        x = (x ^ bytes[n]) * 0x100000001b3ULL;
+      }
+      // Finaliser from MurmurHash3
+      x = id ^ (x * 0x9e3779b97f4a7c15ULL);
+      x ^= x >> 33U;
+      x *= 0xff51afd7ed558ccdULL;
+      x ^= x >> 33U;
+      return static_cast<size_t>(x);
+    }
+
+    bool operator==(const exact_status_code &o) const noexcept
+    {
+      return id == o.id && value == o.value && size == o.size && (size == 0 || memcmp(bytes, o.bytes, size) == 0);
+    }
+  };
+}  // namespace detail
+
+/*! \brief A hash of the domain unique id and value of any status code, for use in hash containers.
+
+Unlike `operator==`, which is semantic, this and `exact_equal` consider two status codes
+the same only if they have the same domain and the same value. Integral values compare
+by value, so `posix_code(EACCES)` and a `system_code` erased from it are the same. Other
+values compare by the bytes of their payload, so for example two `nested_status_code`
+are the same only if they point to the same nested status code.
+*/
+struct exact_hash
+{
+  //! Returns the hash of `code`.
+  size_t operator()(const status_code<void> &code) const noexcept { return detail::exact_status_code(code).hash(); }
+};
+
+//! True if two status codes have the same domain and the same value. See `exact_hash`.
+struct exact_equal
+{
+  //! True if `a` and `b` are exactly equal.
+  bool operator()(const status_code<void> &a, const status_code<void> &b) const noexcept
+  {
+    return detail::exact_status_code(a) == detail::exact_status_code(b);
+  }
+};
+
+/*! \brief A flat, open addressed map from exactly equal status codes to `V`, such as an
+histogram of failures.
+
+Keys are copied into `system_code`, so must be copyable into one, and are found by
+`exact_hash` and `exact_equal` without being copied. Lookups and insertions probe a
+single array of slots, each of which caches its key's hash, so are much cheaper than
+those of a node based `std::unordered_map` for the small maps typical of errors.
+
+`V` must be default constructible and move assignable. As with `std::unordered_map`,
+insertions invalidate iterators and references, and `erase()` invalidates iterators.
+*/
+template <class V> class status_code_map
+{
+public:
+  //! The key type
+  using key_type = system_code;
+  //! The mapped type
+  using mapped_type = V;
+  //! The type of each entry
+  using value_type = std::pair<system_code, V>;
+  //! The size type
+  using size_type = size_t;
+
+private:
+  struct _slot
+  {
+    size_t hash{0};
+    bool used{false};
+    bool integral{false};  // the key is exactly equal to another if their ids and values are equal
+    status_code_domain::unique_id_type id{0};
+    long long value{0};
+    value_type kv;
+  };
+  std::vector<_slot> _slots;
+  size_type _size{0};
+
+  template <class Slot, class Value> class _iterator
+  {
+    friend class status_code_map;
+    template <class, class> friend class _iterator;
+    Slot *_p{nullptr}, *_end{nullptr};
+
+    _iterator(Slot *p, Slot *end) noexcept
+        : _p(p)
+        , _end(end)
+    {
+      while(_p != _end && !_p->used)
+      {
+        ++_p;
+      }
+    }
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename status_code_map::value_type;
+    using difference_type = ptrdiff_t;
+    using pointer = Value *;
+    using reference = Value &;
+
+    _iterator() = default;
+    //! Implicit conversion from a mutable iterator.
+    template <class S, class T, typename std::enable_if<!std::is_same<S, Slot>::value, bool>::type = true>
+    _iterator(const _iterator<S, T> &o) noexcept  // NOLINT
+        : _p(o._p)
+        , _end(o._end)
+    {
+    }
+
+    reference operator*() const noexcept { return _p->kv; }
+    pointer operator->() const noexcept { return &_p->kv; }
+    _iterator &operator++() noexcept
+    {
+      do
+      {
+        ++_p;
+      } while(_p != _end && !_p->used);
+      return *this;
+    }
+    _iterator operator++(int) noexcept
+    {
+      _iterator ret(*this);
+      ++*this;
+      return ret;
+    }
+    bool operator==(const _iterator &o) const noexcept { return _p == o._p; }
+    bool operator!=(const _iterator &o) const noexcept { return _p != o._p; }
+  };
+
+  size_t _mask() const noexcept { return _slots.size() - 1; }
+
+  // The index of the slot holding `code`, or of the empty slot where it would go
+  size_t _probe(const detail::exact_status_code &code, size_t hash) const noexcept
+  {
+    for(size_t idx = hash & _mask();; idx = (idx + 1) & _mask())
+    {
+      const _slot &s = _slots[idx];
+      if(!s.used)
+      {
+        return idx;
+      }
+      if(s.hash == hash && s.id == code.id && s.value == code.value &&
+         (s.integral || detail::exact_status_code(s.kv.first) == code))
+      {
+        return idx;
+      }
+    }
+  }
+
+  void _rehash(size_t capacity)
+  {
+    std::vector<_slot> old(capacity);
+    old.swap(_slots);
+    for(auto &s : old)
+    {
+      if(s.used)
+      {
+        size_t idx = s.hash & _mask();
+        while(_slots[idx].used)
+        {
+          idx = (idx + 1) & _mask();
+        }
+        _slots[idx] = std::move(s);
+      }
+    }
+  }
+
+public:
+  //! A forward iterator over the entries, in no particular order.
+  using iterator = _iterator<_slot, value_type>;
+  //! A forward iterator over the entries, in no particular order.
+  using const_iterator = _iterator<const _slot, const value_type>;
+
+  //! Default constructs an empty map, which does not allocate.
+  status_code_map() = default;
+  //! Constructs an empty map with room for `count` entries.
+  explicit status_code_map(size_type count) { reserve(count); }
+  status_code_map(const status_code_map &) = delete;
+  status_code_map(status_code_map &&o) noexcept
+      : _slots(std::move(o._slots))
+      , _size(o._size)
+  {
+    o._size = 0;
+  }
+  status_code_map &operator=(const status_code_map &) = delete;
+  status_code_map &operator=(status_code_map &&o) noexcept
+  {
+    _slots = std::move(o._slots);
+    _size = o._size;
+    o._slots.clear();
+    o._size = 0;
+    return *this;
+  }
+  ~status_code_map() = default;
+
+  //! True if there are no entries.
+  bool empty() const noexcept { return _size == 0; }
+  //! The number of entries.
+  size_type size() const noexcept { return _size; }
+
+  iterator begin() noexcept { return iterator(_slots.data(), _slots.data() + _slots.size()); }
+  iterator end() noexcept { return iterator(_slots.data() + _slots.size(), _slots.data() + _slots.size()); }
+  const_iterator begin() const noexcept { return const_iterator(_slots.data(), _slots.data() + _slots.size()); }
+  const_iterator end() const noexcept
+  {
+    return const_iterator(_slots.data() + _slots.size(), _slots.data() + _slots.size());
+  }
+
+  //! Ensures there is room for `count` entries without reallocating.
+  void reserve(size_type count)
+  {
+    // At most three quarters of slots are used
+    size_t capacity = 8;
+    while(capacity - capacity / 4 < count)
+    {
+      capacity *= 2;
+    }
+    if(capacity > _slots.size())
+    {
+      _rehash(capacity);
+    }
+  }
+
+  //! Removes all entries, keeping the slots allocated.
+  void clear() noexcept
+  {
+    for(auto &s : _slots)
+    {
+      if(s.used)
+      {
+        s.used = false;
+        s.kv = value_type();
+      }
+    }
+    _size = 0;
+  }
+
+  //! Returns an iterator to the entry exactly equal to `code`, else `end()`.
+  iterator find(const status_code<void> &code) noexcept
+  {
+    if(_size == 0)
+    {
+      return end();
+    }
+    const detail::exact_status_code key(code);
+    const size_t idx = _probe(key, key.hash());
+    return _slots[idx].used ? iterator(_slots.data() + idx, _slots.data() + _slots.size()) : end();
+  }
+  //! Returns an iterator to the entry exactly equal to `code`, else `end()`.
+  const_iterator find(const status_code<void> &code) const noexcept
+  {
+    return const_cast<status_code_map *>(this)->find(code);  // NOLINT
+  }
+  //! Returns one if there is an entry exactly equal to `code`, else zero.
+  size_type count(const status_code<void> &code) const noexcept { return (find(code) != end()) ? 1 : 0; }
+
+  /*! Returns the value of the entry exactly equal to `code`, first inserting a default
+  constructed value if there is none. Fails fatally if `code` cannot be copied into a
+  `system_code`.
+  */
+  V &operator[](const status_code<void> &code)
+  {
+    if(_size + 1 > _slots.size() - _slots.size() / 4)
+    {
+      reserve(_size + 1);
+    }
+    const detail::exact_status_code key(code);
+    const size_t hash = key.hash();
+    _slot &s = _slots[_probe(key, hash)];
+    if(!s.used)
+    {
+      system_code copy(std::nothrow, code);
+      if(copy.empty() != code.empty())
+      {
+        SYSTEM_ERROR2_FATAL("status_code_map: the key could not be copied into a system_code");
+      }
+      s.kv.first = std::move(copy);
+      s.hash = hash;
+      s.used = true;
+      s.integral = (key.size == 0);
+      s.id = key.id;
+      s.value = key.value;
+      ++_size;
+    }
+    return s.kv.second;
+  }
+
+  //! Removes the entry exactly equal to `code`, returning the number of entries removed.
+  size_type erase(const status_code<void> &code) noexcept
+  {
+    iterator it = find(code);
+    if(it == end())
+    {
+      return 0;
+    }
+    // Shift back later entries of the same probe sequence, so that no tombstones are needed
+    size_t hole = static_cast<size_t>(it._p - _slots.data());
+    for(size_t idx = (hole + 1) & _mask(); _slots[idx].used; idx = (idx + 1) & _mask())
+    {
+      const size_t home = _slots[idx].hash & _mask();
+      // Can the entry at idx move back to the hole without passing before its home slot?
+      const bool movable = (hole <= idx) ? (home <= hole || home > idx) : (home <= hole && home > idx);
+      if(movable)
+      {
+        _slots[hole] = std::move(_slots[idx]);
+        hole = idx;
+      }
+    }
+    _slots[hole].used = false;
+    _slots[hole].kv = value_type();
+    --_size;
+    return 1;
+  }
+};
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -27,7 +27,13 @@ http://www.boost.org/LICENSE_1_0.txt)
 
 #include "status_code.hpp"
 
+#include <atomic>
 #include <exception>  // for std::exception
+#include <thread>     // for yield
+
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>  // for _mm_pause
+#endif
 
 SYSTEM_ERROR2_NAMESPACE_BEGIN
 
@@ -35,6 +41,118 @@ SYSTEM_ERROR2_NAMESPACE_BEGIN
  */
 template <class DomainType> class status_error;
 
+namespace detail
+{
+  // Backs off a thread waiting upon another, spinning briefly before yielding its timeslice
+  inline void spin_wait_backoff(unsigned iteration) noexcept
+  {
+    if(iteration < 64)
+    {
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+      _mm_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+      __builtin_ia32_pause();
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+      __asm__ __volatile__("yield");
+#endif
+      return;
+    }
+    std::this_thread::yield();
+  }
+
+  /* Holds the message string of a status_error, rendered upon first use.
+  Throwing and catching a status code then never pays for its message unless
+  `what()` is called. The first caller renders the message, racing callers
+  wait for it to do so, and all later callers just load it. If the domain
+  fails to render it, that caller gets a static string, and the next caller
+  tries again.
+  */
+  template <class StringRef> class lazy_status_error_message
+  {
+    enum _state_t
+    {
+      _empty,
+      _rendering,
+      _ready
+    };
+    mutable std::atomic<int> _state{_empty};
+    union
+    {
+      mutable StringRef _msgref;
+    };
+
+  public:
+    lazy_status_error_message() noexcept {}  // NOLINT
+    lazy_status_error_message(const lazy_status_error_message &o)
+    {
+      if(o._state.load(std::memory_order_acquire) == _ready)
+      {
+        new(&_msgref) StringRef(o._msgref);
+        _state.store(_ready, std::memory_order_relaxed);
+      }
+    }
+    lazy_status_error_message &operator=(const lazy_status_error_message &o)
+    {
+      if(this != &o)
+      {
+        this->~lazy_status_error_message();
+        new(this) lazy_status_error_message(o);
+      }
+      return *this;
+    }
+    ~lazy_status_error_message()
+    {
+      if(_state.load(std::memory_order_acquire) == _ready)
+      {
+        _msgref.~StringRef();
+      }
+    }
+
+    //! Returns the message of `code`, rendering it if this is the first call.
+    template <class Code> const char *c_str(const Code &code) const noexcept
+    {
+      for(unsigned n = 0;; n++)
+      {
+        int state = _state.load(std::memory_order_acquire);
+        if(state == _ready)
+        {
+          return _msgref.c_str();
+        }
+        if(state == _empty &&
+           _state.compare_exchange_strong(state, _rendering, std::memory_order_acquire, std::memory_order_acquire))
+        {
+          if(!_render(code))
+          {
+            _state.store(_empty, std::memory_order_release);
+            return "failed to render the message of the status code";
+          }
+          _state.store(_ready, std::memory_order_release);
+          return _msgref.c_str();
+        }
+        spin_wait_backoff(n);
+      }
+    }
+
+  private:
+    // Unlike `message()`, does not terminate the program if the domain fails to render the message
+    template <class Code> bool _render(const Code &code) const noexcept
+    {
+      if(code.empty())
+      {
+        new(&_msgref) StringRef("(empty)");
+        return true;
+      }
+      typename status_code_domain::string_ref msg;
+      if(status_code_domain_access::message(code.domain(), msg, code) != 0)
+      {
+        return false;
+      }
+      new(&_msgref) StringRef(static_cast<typename status_code_domain::string_ref &&>(msg));
+      return true;
+    }
+  };
+}  // namespace detail
+
 /*! The erased type edition of status_error.
  */
 template <> class status_error<void> : public std::exception
@@ -71,7 +189,7 @@ public:
 template <class DomainType> class status_error : public status_error<void>
 {
   status_code<DomainType> _code;
-  typename DomainType::string_ref _msgref;
+  detail::lazy_status_error_message<typename DomainType::string_ref> _msg;
 
   virtual const status_code<void> &_do_code() const noexcept override final { return _code; }
 
@@ -84,12 +202,11 @@ public:
   //! Constructs an instance
   explicit status_error(status_code<DomainType> code)
       : _code(static_cast<status_code<DomainType> &&>(code))
-      , _msgref(_code.message())
   {
   }
 
   //! Return an explanatory string
-  virtual const char *what() const noexcept override { return _msgref.c_str(); }  // NOLINT
+  virtual const char *what() const noexcept override { return _msg.c_str(_code); }  // NOLINT
 
   //! Returns a reference to the code
   const status_code_type &code() const & { return _code; }
@@ -106,7 +223,7 @@ public:
 template <class ErasedType> class status_error<detail::erased<ErasedType>> : public status_error<void>
 {
   status_code<detail::erased<ErasedType>> _code;
-  typename status_code_domain::string_ref _msgref;
+  detail::lazy_status_error_message<typename status_code_domain::string_ref> _msg;
 
   virtual const status_code<detail::erased<ErasedType>> &_do_code() const noexcept override final { return _code; }
 
@@ -119,12 +236,11 @@ public:
   //! Constructs an instance
   explicit status_error(status_code<detail::erased<ErasedType>> code)
       : _code(static_cast<status_code<detail::erased<ErasedType>> &&>(code))
-      , _msgref(_code.message())
   {
   }
 
   //! Return an explanatory string
-  virtual const char *what() const noexcept override { return _msgref.c_str(); }  // NOLINT
+  virtual const char *what() const noexcept override { return _msg.c_str(_code); }  // NOLINT
 
   //! Returns a reference to the code
   const status_code_type &code() const & { return _code; }
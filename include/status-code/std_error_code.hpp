@@ -33,6 +33,8 @@ http://www.boost.org/LICENSE_1_0.txt)
 #include "win32_code.hpp"
 #endif
 
+#include "detail/lock_free_map.hpp"
+
 #include <system_error>
 
 SYSTEM_ERROR2_NAMESPACE_BEGIN
@@ -74,7 +76,7 @@ class _std_error_code_domain final : public status_code_domain
 #endif
     {
       std::string msg = c.message();
-      return _base::atomic_refcounted_string_ref(msg.c_str(), msg.size());
+      return _base::_copied_string_ref(msg.c_str(), msg.size());
     }
 #if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
     catch(...)
@@ -85,6 +87,25 @@ class _std_error_code_domain final : public status_code_domain
 #endif
   }
 
+  static value_info_t _make_category_value_info(const _error_category_type &category) noexcept
+  {
+    const auto ret = _base::_make_value_info<int>(value_info_t::failure_kind::nonzero);
+    /* The generic category's conditions are its codes, as are the system category's where
+    its codes are POSIX codes, so `_do_generic_code()` returns the value itself.
+    */
+    if(category == std::generic_category())
+    {
+      return ret.with_generic_code_identity();
+    }
+#if !defined(SYSTEM_ERROR2_NOT_POSIX) && !defined(_WIN32)
+    if(category == std::system_category())
+    {
+      return ret.with_generic_code_identity();
+    }
+#endif
+    return ret;
+  }
+
 public:
   //! The value type of the `std::error_code` code, which stores the `int` from the `std::error_code`
   using value_type = int;
@@ -99,7 +120,8 @@ public:
 
   //! Default constructor
   explicit _std_error_code_domain(const _error_category_type &category) noexcept
-      : _base(0x223a160d20de97b4 ^ reinterpret_cast<_base::unique_id_type>(&category))
+      : _base(0x223a160d20de97b4 ^ reinterpret_cast<_base::unique_id_type>(&category),
+              _make_category_value_info(category))
       , _name("std_error_code_domain(")
   {
     _name.append(category.name());
@@ -129,6 +151,7 @@ protected:
   virtual bool _do_equivalent(const status_code<void> &code1, const status_code<void> &code2) const noexcept override;
   virtual void _do_generic_code(_vtable_generic_code_args &args) const noexcept override;
   virtual int _do_message(_vtable_message_args &args) const noexcept override;
+  virtual int _do_message_into(_vtable_message_into_args &args) const noexcept override;
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
   SYSTEM_ERROR2_NORETURN virtual void _do_throw_exception(const status_code<void> &code) const override;
 #endif
@@ -138,60 +161,9 @@ namespace detail
 {
   extern inline _std_error_code_domain *std_error_code_domain_from_category(const std::error_category &category)
   {
-    static constexpr size_t max_items = 64;
-    static struct storage_t
-    {
-      std::atomic<unsigned> _lock;
-      union item_t
-      {
-        int _init;
-        _std_error_code_domain domain;
-        constexpr item_t()
-            : _init(0)
-        {
-        }
-        ~item_t() {}
-      } items[max_items];
-      size_t count{0};
-
-      void lock()
-      {
-        while(_lock.exchange(1, std::memory_order_acquire) != 0)
-          ;
-      }
-      void unlock() { _lock.store(0, std::memory_order_release); }
-
-      storage_t() {}
-      ~storage_t()
-      {
-        lock();
-        for(size_t n = 0; n < count; n++)
-        {
-          items[n].domain.~_std_error_code_domain();
-        }
-        unlock();
-      }
-      _std_error_code_domain *add(const std::error_category &category)
-      {
-        _std_error_code_domain *ret = nullptr;
-        lock();
-        for(size_t n = 0; n < count; n++)
-        {
-          if(items[n].domain.error_category() == category)
-          {
-            ret = &items[n].domain;
-            break;
-          }
-        }
-        if(ret == nullptr && count < max_items)
-        {
-          ret = new(std::addressof(items[count++].domain)) _std_error_code_domain(category);
-        }
-        unlock();
-        return ret;
-      }
-    } storage;
-    return storage.add(category);
+    // Categories are singletons, so key on their address. Lookups are wait free.
+    static lock_free_map<const std::error_category *, _std_error_code_domain> storage;
+    return storage.find_or_emplace(std::addressof(category), category);
   }
 }  // namespace detail
 
@@ -299,6 +271,25 @@ inline int _std_error_code_domain::_do_message(_vtable_message_args &args) const
   return ret;
 }
 
+inline int _std_error_code_domain::_do_message_into(_vtable_message_into_args &args) const noexcept
+{
+  assert(args.code.domain() == *this);
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+  const auto &c = static_cast<const std_error_code &>(args.code);  // NOLINT
+  // The messages of these categories are those of strerror(), which the POSIX domain writes without allocating
+  bool is_strerror = (c.category() == std::generic_category());
+#ifndef _WIN32
+  is_strerror = is_strerror || (c.category() == std::system_category());
+#endif
+  if(is_strerror)
+  {
+    args.ret = posix_code(c.value()).message_into(args.buffer, args.length);
+    return 0;
+  }
+#endif
+  return _base::_do_message_into(args);
+}
+
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
 SYSTEM_ERROR2_NORETURN inline void _std_error_code_domain::_do_throw_exception(const status_code<void> &code) const
 {
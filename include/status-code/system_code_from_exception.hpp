@@ -27,16 +27,127 @@ http://www.boost.org/LICENSE_1_0.txt)
 
 #include "system_code.hpp"
 
+#include "detail/lock_free_map.hpp"
 #include "status_error.hpp"
 
 #include <exception>     // for exception_ptr
 #include <stdexcept>     // for the exception types
 #include <system_error>  // for std::system_error
+#include <typeindex>     // for std::type_index
 
 SYSTEM_ERROR2_NAMESPACE_BEGIN
 
+/*! The type of a function which maps an exception to a system_code, as registered
+with `register_system_code_from_exception()`. It must not throw.
+*/
+using system_code_from_exception_factory = system_code (*)(const std::exception &e);
+
+namespace detail
+{
+  // Returns an empty code if the error code's category is not known
+  inline system_code system_code_from_std_system_error(const std::exception &_e)
+  {
+    const auto &e = static_cast<const std::system_error &>(_e);
+    if(e.code().category() == std::generic_category())
+    {
+      return generic_code(static_cast<errc>(static_cast<int>(e.code().value())));
+    }
+    if(e.code().category() == std::system_category())
+    {
+#ifdef _WIN32
+      return win32_code(e.code().value());
+#else
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+      return posix_code(e.code().value());
+#else
+      return generic_code(static_cast<errc>(e.code().value()));
+#endif
+#endif
+    }
+    // Don't know this error code category, can't wrap it into std_error_code
+    // as its payload won't fit into system_code
+    return {};
+  }
+
+  /* The registry of exception types to system_code factories, keyed by the exact
+  dynamic type of the exception. Besides the registered types, it remembers which
+  standard exception type each exception type thrown so far matched, so the catch
+  clauses need walking only once per type.
+  */
+  class system_code_from_exception_registry
+  {
+    struct _type_index_hash
+    {
+      size_t operator()(const std::type_index &v) const noexcept { return v.hash_code(); }
+    };
+    lock_free_map<std::type_index, std::atomic<system_code_from_exception_factory>, _type_index_hash> _map;
+
+    template <errc Value> static system_code _make(const std::exception & /*unused*/) { return generic_code(Value); }
+
+  public:
+    static system_code_from_exception_registry &get()
+    {
+      static system_code_from_exception_registry v;
+      return v;
+    }
+
+    bool add(const std::type_info &type, system_code_from_exception_factory factory)
+    {
+      auto *p = _map.find_or_emplace(std::type_index(type), factory);
+      if(p == nullptr)
+      {
+        return false;
+      }
+      p->store(factory, std::memory_order_release);
+      return true;
+    }
+    system_code_from_exception_factory find(const std::type_info &type) const noexcept
+    {
+      const auto *p = _map.find(std::type_index(type));
+      return (p != nullptr) ? p->load(std::memory_order_acquire) : nullptr;
+    }
+    // Remembers that the dynamic type of `e` matched the catch clause for `Value`, unless it is registered
+    template <errc Value> system_code matched(const std::exception &e) noexcept
+    {
+      remember(e, &_make<Value>);
+      return generic_code(Value);
+    }
+    void remember(const std::exception &e, system_code_from_exception_factory factory) noexcept
+    {
+      (void) _map.find_or_emplace(std::type_index(typeid(e)), factory);
+    }
+  };
+}  // namespace detail
+
+/*! Registers `factory` as the means of converting an exception whose exact dynamic
+type is `type` into a system_code within `system_code_from_exception()`. The factory
+may `static_cast` the exception it is passed to `type`. Types derived from `type`
+are not matched, and need registering themselves. Registering a type again replaces
+its factory, and registering a standard exception type replaces how it is converted.
+If the factory returns an empty code, matching continues as if the type were not
+registered. Returns false if memory could not be allocated.
+
+This is intended to be called at startup. It is thread safe, but
+`system_code_from_exception()` calls racing a registration may or may not see it.
+*/
+inline bool register_system_code_from_exception(const std::type_info &type, system_code_from_exception_factory factory)
+{
+  return detail::system_code_from_exception_registry::get().add(type, factory);
+}
+//! \overload
+template <class E> inline bool register_system_code_from_exception(system_code_from_exception_factory factory)
+{
+  return register_system_code_from_exception(typeid(E), factory);
+}
+
 /*! A utility function which returns the closest matching system_code to a supplied
 exception ptr.
+
+The exception is rethrown once, and if it is a `status_error`, its code is returned.
+Otherwise the exact dynamic type of the exception is looked up in a hash table of
+factories populated by `register_system_code_from_exception()`, and by the results
+of previous calls. Only if that fails are the standard exception types tried in turn
+by a sequence of catch clauses, whose result is then remembered for that type.
 */
 inline system_code system_code_from_exception(std::exception_ptr &&ep = std::current_exception(),
                                               system_code not_matched = generic_code(errc::resource_unavailable_try_again)) noexcept
@@ -45,6 +156,7 @@ inline system_code system_code_from_exception(std::exception_ptr &&ep = std::cur
   {
     return generic_code(errc::success);
   }
+  auto &registry = detail::system_code_from_exception_registry::get();
   try
   {
     try
@@ -68,77 +180,80 @@ inline system_code system_code_from_exception(std::exception_ptr &&ep = std::cur
       }
       throw;
     }
+    catch(const std::exception &e)
+    {
+      if(auto factory = registry.find(typeid(e)))
+      {
+        system_code ret = factory(e);
+        if(!ret.empty())
+        {
+          ep = std::exception_ptr();
+          return ret;
+        }
+      }
+      throw;
+    }
     catch(...)
     {
       throw;
     }
   }
-  catch(const std::invalid_argument & /*unused*/)
+  catch(const std::invalid_argument &e)
   {
     ep = std::exception_ptr();
-    return generic_code(errc::invalid_argument);
+    return registry.matched<errc::invalid_argument>(e);
   }
-  catch(const std::domain_error & /*unused*/)
+  catch(const std::domain_error &e)
   {
     ep = std::exception_ptr();
-    return generic_code(errc::argument_out_of_domain);
+    return registry.matched<errc::argument_out_of_domain>(e);
   }
-  catch(const std::length_error & /*unused*/)
+  catch(const std::length_error &e)
   {
     ep = std::exception_ptr();
-    return generic_code(errc::argument_list_too_long);
+    return registry.matched<errc::argument_list_too_long>(e);
   }
-  catch(const std::out_of_range & /*unused*/)
+  catch(const std::out_of_range &e)
   {
     ep = std::exception_ptr();
-    return generic_code(errc::result_out_of_range);
+    return registry.matched<errc::result_out_of_range>(e);
   }
-  catch(const std::logic_error & /*unused*/) /* base class for this group */
+  catch(const std::logic_error &e) /* base class for this group */
   {
     ep = std::exception_ptr();
-    return generic_code(errc::invalid_argument);
+    return registry.matched<errc::invalid_argument>(e);
   }
   catch(const std::system_error &e) /* also catches ios::failure */
   {
     ep = std::exception_ptr();
-    if(e.code().category() == std::generic_category())
+    registry.remember(e, &detail::system_code_from_std_system_error);
+    system_code ret = detail::system_code_from_std_system_error(e);
+    if(!ret.empty())
     {
-      return generic_code(static_cast<errc>(static_cast<int>(e.code().value())));
-    }
-    if(e.code().category() == std::system_category())
-    {
-#ifdef _WIN32
-      return win32_code(e.code().value());
-#else
-#ifndef SYSTEM_ERROR2_NOT_POSIX
-      return posix_code(e.code().value());
-#else
-      return generic_code(static_cast<errc>(e.code().value()));
-#endif
-#endif
+      return ret;
     }
     // Don't know this error code category, can't wrap it into std_error_code
     // as its payload won't fit into system_code, so fall through.
   }
-  catch(const std::overflow_error & /*unused*/)
+  catch(const std::overflow_error &e)
   {
     ep = std::exception_ptr();
-    return generic_code(errc::value_too_large);
+    return registry.matched<errc::value_too_large>(e);
   }
-  catch(const std::range_error & /*unused*/)
+  catch(const std::range_error &e)
   {
     ep = std::exception_ptr();
-    return generic_code(errc::result_out_of_range);
+    return registry.matched<errc::result_out_of_range>(e);
   }
-  catch(const std::runtime_error & /*unused*/) /* base class for this group */
+  catch(const std::runtime_error &e) /* base class for this group */
   {
     ep = std::exception_ptr();
-    return generic_code(errc::resource_unavailable_try_again);
+    return registry.matched<errc::resource_unavailable_try_again>(e);
   }
-  catch(const std::bad_alloc & /*unused*/)
+  catch(const std::bad_alloc &e)
   {
     ep = std::exception_ptr();
-    return generic_code(errc::not_enough_memory);
+    return registry.matched<errc::not_enough_memory>(e);
   }
   catch(...)
   {
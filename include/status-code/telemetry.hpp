@@ -0,0 +1,338 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_TELEMETRY_HPP
+#define SYSTEM_ERROR2_TELEMETRY_HPP
+
+#include "status_code_domain.hpp"
+
+#include <algorithm>  // for sort
+#include <chrono>
+#include <mutex>
+#include <new>  // for nothrow
+#include <vector>
+
+#ifndef SYSTEM_ERROR2_TELEMETRY_TABLE_SIZE
+//! The number of distinct (domain id, value) pairs each thread can count. Must be a power of two.
+#define SYSTEM_ERROR2_TELEMETRY_TABLE_SIZE 256
+#endif
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+//! The number of failures of a domain id and value counted by telemetry.
+struct status_code_telemetry_entry
+{
+  status_code_domain::unique_id_type domain_id;  //!< The unique id of the domain
+  long long value;                               //!< The integral value, or zero if the domain's value is not integral
+  unsigned long long count;                      //!< The count, or the count per second if a rate
+};
+
+//! The counts of failures of all threads at a point in time.
+struct status_code_telemetry_snapshot
+{
+  std::chrono::steady_clock::time_point when;          //!< When the snapshot was taken
+  std::vector<status_code_telemetry_entry> entries;    //!< The counts, sorted by domain id and value
+  unsigned long long dropped{0};                       //!< Failures not counted as a thread's table was full
+};
+
+namespace detail
+{
+  /* A table of counts written only by its owning thread, so increments are
+  plain relaxed loads and stores. Slots are claimed by open addressing, and are
+  never released, so readers on other threads see each slot's key published
+  before its count.
+  */
+  struct telemetry_table
+  {
+    static_assert((SYSTEM_ERROR2_TELEMETRY_TABLE_SIZE & (SYSTEM_ERROR2_TELEMETRY_TABLE_SIZE - 1)) == 0,
+                  "SYSTEM_ERROR2_TELEMETRY_TABLE_SIZE must be a power of two");
+    // Neither a valid domain id nor ever a key, as domain ids cannot be zero
+    static constexpr unsigned long long empty_id = 0;
+    static constexpr size_t max_probes = 8;
+
+    struct slot
+    {
+      std::atomic<unsigned long long> id{empty_id};
+      std::atomic<long long> value{0};
+      std::atomic<unsigned long long> count{0};
+    };
+    slot slots[SYSTEM_ERROR2_TELEMETRY_TABLE_SIZE];
+    std::atomic<unsigned long long> dropped{0};
+    telemetry_table *prev{nullptr}, *next{nullptr};
+
+    static size_t index(unsigned long long id, long long value) noexcept
+    {
+      // Finaliser from MurmurHash3
+      auto x = id ^ (static_cast<unsigned long long>(value) * 0x9e3779b97f4a7c15ULL);
+      x ^= x >> 33U;
+      x *= 0xff51afd7ed558ccdULL;
+      x ^= x >> 33U;
+      return static_cast<size_t>(x);
+    }
+
+    void increment(unsigned long long id, long long value) noexcept
+    {
+      size_t idx = index(id, value);
+      for(size_t n = 0; n < max_probes; n++, idx++)
+      {
+        slot &s = slots[idx & (SYSTEM_ERROR2_TELEMETRY_TABLE_SIZE - 1)];
+        const unsigned long long sid = s.id.load(std::memory_order_relaxed);
+        if(sid == id && s.value.load(std::memory_order_relaxed) == value)
+        {
+          s.count.store(s.count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+          return;
+        }
+        if(sid == empty_id)
+        {
+          s.value.store(value, std::memory_order_relaxed);
+          s.count.store(1, std::memory_order_relaxed);
+          s.id.store(id, std::memory_order_release);
+          return;
+        }
+      }
+      dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+  };
+
+  // Owns the tables of all live threads, and the counts of threads which have exited
+  struct telemetry_registry
+  {
+    std::mutex lock;
+    telemetry_table *tables{nullptr};
+    std::vector<status_code_telemetry_entry> retired;
+    unsigned long long retired_dropped{0};
+
+    static telemetry_registry &get() noexcept
+    {
+      static telemetry_registry v;
+      return v;
+    }
+
+    static void add_to(std::vector<status_code_telemetry_entry> &out, const telemetry_table &table)
+    {
+      for(const auto &s : table.slots)
+      {
+        const unsigned long long id = s.id.load(std::memory_order_acquire);
+        if(id != telemetry_table::empty_id)
+        {
+          out.push_back({id, s.value.load(std::memory_order_relaxed), s.count.load(std::memory_order_relaxed)});
+        }
+      }
+    }
+    // Sorts by key, summing the counts of equal keys
+    static void merge(std::vector<status_code_telemetry_entry> &entries)
+    {
+      std::sort(entries.begin(), entries.end(),
+                [](const status_code_telemetry_entry &a, const status_code_telemetry_entry &b) {
+                  return (a.domain_id != b.domain_id) ? (a.domain_id < b.domain_id) : (a.value < b.value);
+                });
+      size_t out = 0;
+      for(size_t n = 0; n < entries.size(); n++)
+      {
+        if(out > 0 && entries[out - 1].domain_id == entries[n].domain_id && entries[out - 1].value == entries[n].value)
+        {
+          entries[out - 1].count += entries[n].count;
+        }
+        else
+        {
+          entries[out++] = entries[n];
+        }
+      }
+      entries.resize(out);
+    }
+
+    void attach(telemetry_table *table)
+    {
+      std::lock_guard<std::mutex> g(lock);
+      table->next = tables;
+      if(tables != nullptr)
+      {
+        tables->prev = table;
+      }
+      tables = table;
+    }
+    void detach(telemetry_table *table)
+    {
+      std::lock_guard<std::mutex> g(lock);
+      (table->prev != nullptr ? table->prev->next : tables) = table->next;
+      if(table->next != nullptr)
+      {
+        table->next->prev = table->prev;
+      }
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
+      try
+#endif
+      {
+        add_to(retired, *table);
+        merge(retired);
+      }
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
+      catch(...)
+      {
+        // The counts of this thread are lost
+      }
+#endif
+      retired_dropped += table->dropped.load(std::memory_order_relaxed);
+    }
+  };
+
+  /* The calling thread's table, created upon its first failure and retired upon
+  thread exit. The thread local state is trivially destructible, so failures during
+  the destruction of other thread locals are safely not counted.
+  */
+  struct telemetry_thread
+  {
+    telemetry_table *table;
+    bool closed;
+
+    struct reaper
+    {
+      ~reaper()
+      {
+        telemetry_thread &t = state();
+        t.closed = true;
+        if(t.table != nullptr)
+        {
+          telemetry_registry::get().detach(t.table);
+          delete t.table;
+          t.table = nullptr;
+        }
+      }
+    };
+
+    static telemetry_thread &state() noexcept
+    {
+      static thread_local telemetry_thread v;
+      return v;
+    }
+    static telemetry_table *create() noexcept
+    {
+      telemetry_thread &t = state();
+      if(t.closed)
+      {
+        return nullptr;
+      }
+      auto *table = new(std::nothrow) telemetry_table;
+      if(table == nullptr)
+      {
+        return nullptr;
+      }
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
+      try
+#endif
+      {
+        telemetry_registry::get().attach(table);
+      }
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
+      catch(...)
+      {
+        delete table;
+        return nullptr;
+      }
+#endif
+      static thread_local reaper r;
+      (void) r;
+      t.table = table;
+      return table;
+    }
+    static telemetry_table *get() noexcept
+    {
+      telemetry_table *table = state().table;
+      return (table != nullptr) ? table : create();
+    }
+  };
+
+  //! Counts a failure of domain id `id` and value `value` on the calling thread. No locks except upon first use.
+  inline void telemetry_record(unsigned long long id, long long value) noexcept
+  {
+    if(telemetry_table *table = telemetry_thread::get())
+    {
+      table->increment(id, value);
+    }
+  }
+}  // namespace detail
+
+/*! \brief Returns the counts of failures of all threads since process start.
+
+If `SYSTEM_ERROR2_ENABLE_TELEMETRY` is true, every erased status code constructed
+as a failure is counted by its domain id and value, in a table of the constructing
+thread. This gathers the tables of all threads, plus the counts of threads which
+have since exited. Counting continues concurrently, so counts are monotonic but
+may not be mutually consistent.
+
+Take snapshots periodically and pass them to `status_code_telemetry_rates()` to
+obtain rates.
+*/
+inline status_code_telemetry_snapshot status_code_telemetry_take_snapshot()
+{
+  auto &registry = detail::telemetry_registry::get();
+  status_code_telemetry_snapshot ret;
+  std::lock_guard<std::mutex> g(registry.lock);
+  ret.when = std::chrono::steady_clock::now();
+  ret.entries = registry.retired;
+  ret.dropped = registry.retired_dropped;
+  for(const detail::telemetry_table *table = registry.tables; table != nullptr; table = table->next)
+  {
+    detail::telemetry_registry::add_to(ret.entries, *table);
+    ret.dropped += table->dropped.load(std::memory_order_relaxed);
+  }
+  detail::telemetry_registry::merge(ret.entries);
+  return ret;
+}
+
+//! Returns the failures per second of each domain id and value between two snapshots, omitting those with none.
+inline std::vector<status_code_telemetry_entry> status_code_telemetry_rates(const status_code_telemetry_snapshot &before,
+                                                                            const status_code_telemetry_snapshot &after)
+{
+  std::vector<status_code_telemetry_entry> ret;
+  const double secs = std::chrono::duration<double>(after.when - before.when).count();
+  if(secs <= 0)
+  {
+    return ret;
+  }
+  // Both are sorted by key
+  auto it = before.entries.begin();
+  for(const auto &i : after.entries)
+  {
+    while(it != before.entries.end() &&
+          (it->domain_id < i.domain_id || (it->domain_id == i.domain_id && it->value < i.value)))
+    {
+      ++it;
+    }
+    unsigned long long count = i.count;
+    if(it != before.entries.end() && it->domain_id == i.domain_id && it->value == i.value)
+    {
+      count -= it->count;
+    }
+    if(count > 0)
+    {
+      ret.push_back({i.domain_id, i.value, static_cast<unsigned long long>(static_cast<double>(count) / secs + 0.5)});
+    }
+  }
+  return ret;
+}
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
@@ -29,6 +29,7 @@ http://www.boost.org/LICENSE_1_0.txt)
 #error This file should only be included on Windows
 #endif
 
+#include "detail/windows_code_mapping.hpp"
 #include "quick_status_code_from_enum.hpp"
 
 #if defined(_MSC_VER) && !defined(__clang__)
@@ -106,16 +107,7 @@ class _win32_code_domain : public status_code_domain
   template <class DomainType> friend class status_code;
   friend class _com_code_domain;
   using _base = status_code_domain;
-  static int _win32_code_to_errno(win32::DWORD c)
-  {
-    switch(c)
-    {
-    case 0:
-      return 0;
-#include "detail/win32_code_to_generic_code.ipp"
-    }
-    return -1;
-  }
+  static int _win32_code_to_errno(win32::DWORD c) { return detail::win32_code_to_errno(static_cast<uint32_t>(c)); }
   //! Construct from a Win32 error code
   static _base::string_ref _make_string_ref(int &errcode, win32::DWORD c) noexcept
   {
@@ -169,9 +161,21 @@ public:
   using _base::string_ref;
 
 public:
+  //! Describes this domain's values, see `status_code_domain::value_info_t`
+  static constexpr value_info_t _default_value_info() noexcept
+  {
+    return _make_value_info<value_type>(value_info_t::failure_kind::nonzero);
+  }
   //! Default constructor
   constexpr explicit _win32_code_domain(typename _base::unique_id_type id = 0x8cd18ee72d680f1b) noexcept
-      : _base(id)
+      : _base(id, _own_value_info(id, 0x8cd18ee72d680f1b, _default_value_info()))
+  {
+  }
+  /*! Constructor for a domain derived from this one, which by passing `value_info` opts into
+  `failure()` and `equivalent()` being determined from it where possible.
+  */
+  constexpr _win32_code_domain(typename _base::unique_id_type id, value_info_t value_info) noexcept
+      : _base(id, value_info)
   {
   }
   _win32_code_domain(const _win32_code_domain &) = default;
@@ -0,0 +1,273 @@
+/* Proposed SG14 status_code
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#ifndef SYSTEM_ERROR2_WIRE_FORMAT_HPP
+#define SYSTEM_ERROR2_WIRE_FORMAT_HPP
+
+#include "domain_registry.hpp"
+#include "system_code.hpp"
+
+#include <cstdint>
+
+#ifndef SYSTEM_ERROR2_WIRE_FORMAT_MAX_MESSAGE
+//! The maximum number of characters of a message serialised with a status code. Longer messages are truncated.
+#define SYSTEM_ERROR2_WIRE_FORMAT_MAX_MESSAGE 1023
+#endif
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+
+/*! \brief The fixed sixteen byte header of a status code serialised by `serialise_status_code()`.
+
+The domain id is zero for an empty code. The value is the integral value of the
+code as described by its domain's `value_info()`, sign extended to 64 bits if it is
+signed. Both are in the native byte order, as the wire format is intended for transport between processes
+on the same machine, such as through shared memory.
+
+If a message was serialised, the header is followed by its length in bytes as a
+`uint32_t`, then by the message and a terminating null. Whether a message follows
+is determined by the length of the serialised code, so the transport must preserve
+that length.
+*/
+struct status_code_wire_header
+{
+  status_code_domain::unique_id_type domain_id;  //!< The unique id of the domain, or zero if empty
+  long long value;                               //!< The integral value, sign extended if it is signed
+};
+static_assert(sizeof(status_code_wire_header) == 16, "status_code_wire_header is not sixteen bytes in size!");
+
+namespace detail
+{
+  // Loads and stores the integral values of status codes as their domains describe them
+  struct status_code_wire_access
+  {
+    static bool load(long long &out, const status_code<void> &code) noexcept
+    {
+      return status_code_domain_access::load_integral_value(code.domain(), out, code);
+    }
+    static system_code make(const status_code_domain &domain, long long value) noexcept
+    {
+      alignas(system_code) char image[sizeof(system_code)] = {};
+      if(!status_code_domain_access::store_integral_value(domain, image, sizeof(image), value))
+      {
+        return {};
+      }
+      return system_code(std::nothrow, *reinterpret_cast<const status_code<void> *>(image));  // NOLINT
+    }
+  };
+  // The message of a code as serialised, rendered without throwing nor allocating
+  struct wire_message
+  {
+    char buffer[SYSTEM_ERROR2_WIRE_FORMAT_MAX_MESSAGE + 1];
+    size_t size;
+
+    explicit wire_message(const status_code<void> &code) noexcept
+        : size(code.message_into(buffer, sizeof(buffer)))
+    {
+    }
+  };
+}  // namespace detail
+
+//! Returns the number of bytes which serialising `code` would need, or zero if it cannot be serialised.
+inline size_t serialised_status_code_size(const status_code<void> &code, bool with_message = false) noexcept
+{
+  if(code.empty())
+  {
+    return sizeof(status_code_wire_header);
+  }
+  // Only codes which can be bit copied into a `system_code` can be serialised
+  const auto info = code.domain().payload_info();
+  if(info.total_size > sizeof(system_code) || code.domain().value_info().size == 0)
+  {
+    return 0;
+  }
+  if(!with_message)
+  {
+    return sizeof(status_code_wire_header);
+  }
+  const detail::wire_message msg(code);
+  return sizeof(status_code_wire_header) + sizeof(uint32_t) + msg.size + 1;
+}
+
+/*! \brief Serialises `code` into `buffer`, returning the number of bytes written, or
+zero if `bytes` is too small or `code` cannot be serialised.
+
+Only codes whose domain describes an integral value via `status_code_domain::value_info()`,
+and which can be erased into a `system_code`, can be serialised. If `with_message` is
+true, the code's message is appended, truncated to `SYSTEM_ERROR2_WIRE_FORMAT_MAX_MESSAGE`
+characters, so that it is available even where the domain is not. If the domain fails
+to render the message, it is empty.
+
+The domain of `code` is registered with the domain registry, so codes serialised by
+this process can be deserialised by it. To be deserialised by another process, the
+domain must be one of the built-in domains, or be registered with the domain registry
+of that process, see `register_status_code_domain()`.
+*/
+inline size_t serialise_status_code(void *buffer, size_t bytes, const status_code<void> &code,
+                                    bool with_message = false) noexcept
+{
+  status_code_wire_header header{0, 0};
+  if(!code.empty())
+  {
+    if(code.domain().value_info().size == 0)
+    {
+      return 0;
+    }
+    const system_code erased(std::nothrow, code);
+    if(erased.empty() || !detail::status_code_wire_access::load(header.value, erased))
+    {
+      return 0;
+    }
+    header.domain_id = erased.domain().id();
+    register_status_code_domain(erased.domain());
+  }
+  auto *p = static_cast<char *>(buffer);
+  if(!with_message || code.empty())
+  {
+    if(bytes < sizeof(header))
+    {
+      return 0;
+    }
+    memcpy(p, &header, sizeof(header));
+    return sizeof(header);
+  }
+  const detail::wire_message msg(code);
+  const size_t needed = sizeof(header) + sizeof(uint32_t) + msg.size + 1;
+  if(bytes < needed)
+  {
+    return 0;
+  }
+  const auto len = static_cast<uint32_t>(msg.size);
+  memcpy(p, &header, sizeof(header));
+  memcpy(p + sizeof(header), &len, sizeof(len));
+  memcpy(p + sizeof(header) + sizeof(len), msg.buffer, len);
+  p[needed - 1] = 0;
+  return needed;
+}
+
+/*! \brief A view of a status code serialised by `serialise_status_code()`, read in place.
+
+Nothing is copied until `code()` reconstitutes the status code, which is a lookup
+of the domain in the domain registry followed by a bit copy into a `system_code`
+via the domain's `_do_erased_copy()`.
+*/
+class serialised_status_code_view
+{
+  const char *_p{nullptr};
+  size_t _size{0};
+  uint32_t _message_size{0};
+  bool _has_message{false};
+
+public:
+  //! Constructs an invalid view.
+  serialised_status_code_view() = default;
+  //! Views the serialised status code of `bytes` bytes at `buffer`. If it is malformed, the view is invalid.
+  serialised_status_code_view(const void *buffer, size_t bytes) noexcept
+  {
+    const auto *p = static_cast<const char *>(buffer);
+    if(bytes < sizeof(status_code_wire_header))
+    {
+      return;
+    }
+    if(bytes == sizeof(status_code_wire_header))
+    {
+      _p = p;
+      _size = bytes;
+      return;
+    }
+    uint32_t len;
+    if(bytes < sizeof(status_code_wire_header) + sizeof(len) + 1)
+    {
+      return;
+    }
+    memcpy(&len, p + sizeof(status_code_wire_header), sizeof(len));
+    const size_t needed = sizeof(status_code_wire_header) + sizeof(len) + static_cast<size_t>(len) + 1;
+    if(bytes != needed || p[needed - 1] != 0)
+    {
+      return;
+    }
+    _p = p;
+    _size = needed;
+    _message_size = len;
+    _has_message = true;
+  }
+
+  //! True if the view refers to a well formed serialised status code.
+  bool valid() const noexcept { return _p != nullptr; }
+  //! The number of bytes of the serialised status code.
+  size_t size() const noexcept { return _size; }
+
+  //! The fixed size header.
+  status_code_wire_header header() const noexcept
+  {
+    status_code_wire_header ret{0, 0};
+    if(_p != nullptr)
+    {
+      memcpy(&ret, _p, sizeof(ret));
+    }
+    return ret;
+  }
+  //! The unique id of the domain, or zero if empty.
+  status_code_domain::unique_id_type domain_id() const noexcept { return header().domain_id; }
+  //! The integral value.
+  long long value() const noexcept { return header().value; }
+  //! The registered domain, or null if the code is empty or its domain is not registered in this process.
+  const status_code_domain *domain() const noexcept
+  {
+    const auto id = domain_id();
+    return (id != 0) ? status_code_domain_from_id(id) : nullptr;
+  }
+
+  //! True if a message was serialised.
+  bool has_message() const noexcept { return _has_message; }
+  //! The serialised message, referring into the buffer, or an empty string if there is none.
+  status_code_domain::string_ref message() const noexcept
+  {
+    return _has_message ? status_code_domain::string_ref(_p + sizeof(status_code_wire_header) + sizeof(uint32_t),
+                                                         _message_size) :
+                          status_code_domain::string_ref("");
+  }
+
+  /*! Reconstitutes the status code. It is empty if the serialised code was, or if its
+  domain is not registered in this process, or if the domain refused the copy.
+  */
+  system_code code() const noexcept
+  {
+    const status_code_domain *d = domain();
+    if(d == nullptr)
+    {
+      return {};
+    }
+    return detail::status_code_wire_access::make(*d, value());
+  }
+};
+
+//! Deserialises the status code of `bytes` bytes at `buffer`, returning an empty code if it cannot be.
+inline system_code deserialise_status_code(const void *buffer, size_t bytes) noexcept
+{
+  return serialised_status_code_view(buffer, bytes).code();
+}
+
+SYSTEM_ERROR2_NAMESPACE_END
+
+#endif
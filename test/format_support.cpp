@@ -0,0 +1,182 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "status-code/format_support.hpp"
+#include "status-code/http_status_code.hpp"
+#include "status-code/nested_status_code.hpp"
+#include "status-code/std_error_code.hpp"
+#include "status-code/system_error2.hpp"
+#ifdef TEST_FMT_SUPPORT
+#include "status-code/fmt_support.hpp"
+#endif
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+#define CHECK(expr)                                                                                                    \
+  if(!(expr))                                                                                                          \
+  {                                                                                                                    \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                           \
+    retcode = 1;                                                                                                       \
+  }
+
+using namespace SYSTEM_ERROR2_NAMESPACE;
+
+// Counts heap allocations, so we can check that formatting makes none
+static size_t allocations;
+void *operator new(size_t bytes)
+{
+  ++allocations;
+  if(void *p = malloc(bytes ? bytes : 1))
+  {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+void *operator new(size_t bytes, const std::nothrow_t & /*unused*/) noexcept
+{
+  ++allocations;
+  return malloc(bytes ? bytes : 1);
+}
+void operator delete(void *p) noexcept
+{
+  free(p);
+}
+void operator delete(void *p, size_t /*unused*/) noexcept
+{
+  free(p);
+}
+
+// Runs the same tests against std::format and fmt, formatting into a fixed buffer
+template <class Library> static int test_format(const char *library)
+{
+  int retcode = 0;
+  char buffer[512];
+  char expected[512];
+  auto format = [&](const char *spec, const auto &v) -> const char * {
+    *Library::format_to(buffer, spec, v) = 0;
+    return buffer;
+  };
+
+  const posix_code posix(ENOENT);
+  const system_code erased(posix_code(EACCES));
+  const system_code nested(make_nested_status_code(posix_code(EINVAL)));
+  const std_error_code std_ec(std::error_code(ENOENT, std::generic_category()));
+  const http_status_code http(404);
+  const error errored(generic_code(errc::timed_out));
+  const system_code empty;
+
+  // Rendering some of these messages allocates, so do so before counting allocations
+  const std::string posix_message(posix.message().c_str()), erased_message(erased.message().c_str()),
+  nested_message(nested.message().c_str()), std_ec_message(std_ec.message().c_str());
+  snprintf(expected, sizeof(expected), "posix domain: %s", posix_message.c_str());
+
+  const size_t before = allocations;
+  CHECK(strcmp(format("{}", posix), expected) == 0);
+  CHECK(strcmp(format("{:n}", posix), "posix domain") == 0);
+  CHECK(strcmp(format("{:m}", posix), posix_message.c_str()) == 0);
+  CHECK(strcmp(format("{:v}", posix), "2") == 0);
+  CHECK(strcmp(format("{:x}", http), "194") == 0);
+  CHECK(strcmp(format("{:v}", erased), "13") == 0);
+  CHECK(strcmp(format("{:m}", erased), erased_message.c_str()) == 0);
+  CHECK(strcmp(format("{:m}", nested), nested_message.c_str()) == 0);
+  CHECK(strcmp(format("{:m}", std_ec), std_ec_message.c_str()) == 0);
+  CHECK(strcmp(format("{:n}", errored), "generic domain") == 0);
+  CHECK(strcmp(format("{:v}", errored), "110") == 0);
+  CHECK(strcmp(format("{}", empty), "(empty)") == 0);
+  CHECK(strcmp(format("{:v}", empty), "(empty)") == 0);
+  // Negative values are written with a sign in decimal, and as wide as their domain's value in hexadecimal
+  CHECK(strcmp(format("{:v}", posix_code(-2)), "-2") == 0);
+  CHECK(strcmp(format("{:x}", posix_code(-2)), "fffffffe") == 0);
+  // The value of a nested code is a pointer, which no domain describes as integral
+  CHECK(strcmp(format("{:v}", nested), "(opaque)") == 0);
+  const size_t after = allocations;
+  if(after != before)
+  {
+    fprintf(stderr, "%s: formatting made %zu allocations\n", library, after - before);
+    retcode = 1;
+  }
+
+#if __cplusplus >= 201703L || _HAS_CXX17
+  CHECK(strcmp(format("{}", result<int>(5)), "5") == 0);
+  CHECK(strcmp(format("{}", result<void>(in_place_type<void>)), "success") == 0);
+  CHECK(strcmp(format("{:v}", result<int>(generic_code(errc::timed_out))), "110") == 0);
+#endif
+
+  // Invalid format specs are rejected
+  for(const char *spec : {"{:q}", "{:mm}", "{:>10}"})
+  {
+    bool threw = false;
+    try
+    {
+      format(spec, posix);
+    }
+    catch(const typename Library::format_error &)
+    {
+      threw = true;
+    }
+    CHECK(threw);
+  }
+  if(retcode == 0)
+  {
+    printf("%s tests passed\n", library);
+  }
+  return retcode;
+}
+
+#ifdef __cpp_lib_format
+struct std_library
+{
+  using format_error = std::format_error;
+  template <class T> static char *format_to(char *buffer, const char *spec, const T &v)
+  {
+    return std::vformat_to(buffer, spec, std::make_format_args(v));
+  }
+};
+#endif
+#ifdef TEST_FMT_SUPPORT
+struct fmt_library
+{
+  using format_error = fmt::format_error;
+  template <class T> static char *format_to(char *buffer, const char *spec, const T &v)
+  {
+    return fmt::vformat_to(buffer, spec, fmt::make_format_args(v));
+  }
+};
+#endif
+
+int main()
+{
+  int retcode = 0;
+#ifdef __cpp_lib_format
+  retcode |= test_format<std_library>("std::format");
+#endif
+#ifdef TEST_FMT_SUPPORT
+  retcode |= test_format<fmt_library>("fmt");
+#endif
+  return retcode;
+}
@@ -28,11 +28,19 @@ http://www.boost.org/LICENSE_1_0.txt)
 #include "status-code/getaddrinfo_code.hpp"
 #endif
 
+#include "status-code/atomic_status_code.hpp"
+#include "status-code/flight_recorder.hpp"
 #include "status-code/http_status_code.hpp"
+#include "status-code/http_status_line.hpp"
 #include "status-code/iostream_support.hpp"
+#include "status-code/message_arena.hpp"
 #include "status-code/nested_status_code.hpp"
+#include "status-code/packed_status_code.hpp"
+#include "status-code/remote_com_code.hpp"
+#include "status-code/status_code_map.hpp"
 #include "status-code/std_error_code.hpp"
 #include "status-code/system_error2.hpp"
+#include "status-code/wire_format.hpp"
 
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
 #include "status-code/system_code_from_exception.hpp"
@@ -48,6 +56,9 @@ http://www.boost.org/LICENSE_1_0.txt)
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #ifdef _MSC_VER
 #define strdup _strdup
@@ -273,6 +284,49 @@ inline constexpr const Code_domain_impl &Code_domain_impl::get()
 {
   return Code_domain;
 }
+// Domain deriving from generic which cannot render its messages
+class Unprintable_domain_impl;
+using UnprintableCode = system_error2::status_code<Unprintable_domain_impl>;
+class Unprintable_domain_impl final : public system_error2::_generic_code_domain
+{
+public:
+  constexpr Unprintable_domain_impl() noexcept
+      : system_error2::_generic_code_domain(0x3d91c0b5e7a4f216)
+  {
+  }
+  static inline constexpr const Unprintable_domain_impl &get();
+  virtual int _do_message(_vtable_message_args & /*unused*/) const noexcept override { return ENOMEM; }  // NOLINT
+};
+constexpr Unprintable_domain_impl Unprintable_domain;
+inline constexpr const Unprintable_domain_impl &Unprintable_domain_impl::get()
+{
+  return Unprintable_domain;
+}
+#ifndef SYSTEM_ERROR2_NOT_POSIX
+// Domain deriving from posix which does not consider EINTR a failure
+class Interrupted_domain_impl;
+using InterruptedCode = system_error2::status_code<Interrupted_domain_impl>;
+class Interrupted_domain_impl final : public system_error2::_posix_code_domain
+{
+public:
+  constexpr Interrupted_domain_impl() noexcept
+      : system_error2::_posix_code_domain(0x6a4e5fd1a2b8c307)
+  {
+  }
+  static inline constexpr const Interrupted_domain_impl &get();
+  virtual bool _do_failure(const system_error2::status_code<void> &code) const noexcept override  // NOLINT
+  {
+    assert(code.domain() == *this);
+    const int value = static_cast<const InterruptedCode &>(code).value();  // NOLINT
+    return value != 0 && value != EINTR;
+  }
+};
+constexpr Interrupted_domain_impl Interrupted_domain;
+inline constexpr const Interrupted_domain_impl &Interrupted_domain_impl::get()
+{
+  return Interrupted_domain;
+}
+#endif
 // Test make_status_code ADL helper
 struct ADLHelper1
 {
@@ -596,10 +650,86 @@ inline int test_http_status_code_function()
   }
 #endif
 
+  // Test parsing status lines
+  {
+    CHECK(parse_http_status_line("HTTP/1.1 200 OK\r\n", 17).value() == 200);
+    CHECK(parse_http_status_line("HTTP/1.0 404 Not Found\r\n", 24).value() == 404);
+    CHECK(parse_http_status_line("HTTP/1.1 503", 12).value() == 503);
+    CHECK(parse_http_status_line("HTTP/1.1 204\r\n", 14).value() == 204);
+    CHECK(parse_http_status_line("HTTP/1.1 502 Bad Gateway", 24).is_http_server_error());
+    CHECK(parse_http_status_line("HTTP/1.1 20", 11).empty());
+    CHECK(parse_http_status_line("HTTP/1.1 2000 OK", 16).empty());
+    CHECK(parse_http_status_line("HTTP/2 200 OK\r\n", 15).empty());
+    CHECK(parse_http_status_line("HTTP/1.1  200 OK", 16).empty());
+    CHECK(parse_http_status_line("http/1.1 200 OK", 15).empty());
+    CHECK(parse_http_status_line("", 0).empty());
+
+    // Every byte of the line at every position must be parsed as it is a byte at a time
+    const char line[] = "HTTP/1.1 503 Service Unavailable";
+    for(size_t length = 0; length <= 16; length++)
+    {
+      for(size_t idx = 0; idx < length; idx++)
+      {
+        for(int c = 0; c < 256; c++)
+        {
+          char mutated[sizeof(line)];
+          memcpy(mutated, line, sizeof(line));
+          mutated[idx] = static_cast<char>(c);
+          const int expected = detail::parse_http_status_line_scalar(mutated, length);
+          const http_status_code code = parse_http_status_line(mutated, length);
+          CHECK((expected < 0) ? code.empty() : (code.value() == expected));
+        }
+      }
+    }
+
+    // A batch crossing bitmap words, of odd length, mixing well formed and malformed lines
+    const char *const samples[] = {"HTTP/1.1 200 OK\r\n", "HTTP/1.1 503 Service Unavailable\r\n", "HTTP/1.0 500",
+                                   "HTTP/1.1 404 Not Found\r\n", "HTTP/1.1 5xx Broken\r\n", "HTTP/1.1 599\n"};
+    const size_t sample_count = sizeof(samples) / sizeof(samples[0]);
+    const size_t count = 131;
+    const char *lines[count];
+    size_t lengths[count];
+    for(size_t n = 0; n < count; n++)
+    {
+      lines[n] = samples[(n * 7) % sample_count];
+      lengths[n] = strlen(lines[n]);
+    }
+    http_status_code codes[count];
+    uint64_t server_errors[http_status_lines_bitmap_words(count) + 1];
+    server_errors[http_status_lines_bitmap_words(count)] = 0xdeadbeef;
+    const size_t parsed = parse_http_status_lines(codes, server_errors, lines, lengths, count);
+    size_t expected_parsed = 0;
+    for(size_t n = 0; n < count; n++)
+    {
+      const http_status_code expected = parse_http_status_line(lines[n], lengths[n]);
+      expected_parsed += !expected.empty();
+      CHECK(codes[n].empty() == expected.empty());
+      CHECK(codes[n].value() == expected.value());
+      const uint64_t bit = (server_errors[n / 64] >> (n % 64)) & 1;
+      CHECK(bit == static_cast<uint64_t>(codes[n].is_http_server_error()));
+    }
+    CHECK(parsed == expected_parsed);
+    CHECK(parsed < count);
+    CHECK(server_errors[http_status_lines_bitmap_words(count)] == 0xdeadbeef);
+    CHECK(parse_http_status_lines(codes, nullptr, lines, lengths, count) == parsed);
+  }
+
   printf("http_status_code tests passed\n");
   return retcode;
 }
 
+// Looks up the generic domain during static destruction, after any registry with a destructor would have been destroyed
+static struct domain_registry_user_at_exit
+{
+  ~domain_registry_user_at_exit()
+  {
+    if(system_error2::status_code_domain_from_id(system_error2::generic_code_domain.id()) == nullptr)
+    {
+      abort();
+    }
+  }
+} domain_registry_user_at_exit_instance;
+
 int main()
 {
   using namespace SYSTEM_ERROR2_NAMESPACE;
@@ -710,6 +840,31 @@ int main()
     erased_status_code<Foo1> test2(std::move(test1));
     (void) test2;
   }
+  // Domains describing their failure predicate don't need a virtual call to determine failure
+  {
+    CHECK(generic_code_domain.value_info().failure == status_code_domain::value_info_t::failure_kind::nonzero);
+    CHECK(generic_code_domain.value_info().size == sizeof(errc));
+    CHECK(http_status_code_domain.value_info().failure ==
+          status_code_domain::value_info_t::failure_kind::greater_equal);
+    CHECK(StatusCode(Code::goaway).domain().value_info().failure ==
+          status_code_domain::value_info_t::failure_kind::opaque);
+    const int http_values[] = {0, 100, 200, 399, 400, 404, 599, -1};
+    for(int v : http_values)
+    {
+      http_status_code typed(v);
+      system_code erased(typed);
+      CHECK(erased.failure() == (v >= 400));
+      CHECK(erased.success() == (v < 400));
+    }
+    system_code generic_success(errc::success), generic_failure(errc::invalid_argument);
+    CHECK(generic_success.success());
+    CHECK(generic_failure.failure());
+    erased_status_code<long long> generic_failure_ll(errc::invalid_argument);
+    CHECK(generic_failure_ll.failure());
+    system_code custom_success(StatusCode(Code::success2)), custom_failure(StatusCode(Code::error2));
+    CHECK(custom_success.success());
+    CHECK(custom_failure.failure());
+  }
 
   // ostream printers
   std::cout << "\ngeneric_code failure: " << failure1 << std::endl;
@@ -829,6 +984,69 @@ int main()
   printf("\ngetaddrinfo_code says the string for EAI_NONAME is '%s'\n", gai.message().c_str());
 #endif
 
+  // Test remote_win32_code, remote_nt_code and remote_com_code, which decode codes from Windows on any platform
+  {
+    const remote_win32_code win32success(0 /*ERROR_SUCCESS*/), win32failure(0x5 /*ERROR_ACCESS_DENIED*/);
+    const remote_nt_code ntsuccess(1 /* positive */);
+    const remote_nt_code ntfailure(static_cast<int32_t>(0xC0000022) /*STATUS_ACCESS_DENIED*/);
+    const remote_com_code comwin32(static_cast<int32_t>(0x80070005) /*HRESULT_FROM_WIN32(ERROR_ACCESS_DENIED)*/);
+    const remote_com_code comnt(static_cast<int32_t>(0xD0000022) /*HRESULT_FROM_NT(STATUS_ACCESS_DENIED)*/);
+    CHECK(win32success.success());
+    CHECK(win32failure.failure());
+    CHECK(ntsuccess.success());
+    CHECK(ntfailure.failure());
+    CHECK(comwin32.failure());
+    CHECK(remote_com_code(0 /*S_OK*/).success());
+    CHECK(win32success == errc::success);
+    CHECK(win32failure == errc::permission_denied);
+    CHECK(ntsuccess == errc::success);
+    CHECK(ntfailure == errc::permission_denied);
+    CHECK(ntfailure == win32failure);
+    CHECK(ntfailure == failure1);
+    CHECK(comwin32 == errc::permission_denied);
+    CHECK(comwin32 == win32failure);
+    CHECK(comnt == errc::permission_denied);
+    CHECK(comnt == ntfailure);
+    CHECK(comnt == comwin32);
+    // E_FAIL is neither a Win32 nor an NT code, so it maps onto nothing
+    const remote_com_code efail(static_cast<int32_t>(0x80004005) /*E_FAIL*/);
+    CHECK(efail != errc::permission_denied);
+    // ERROR_SHARING_VIOLATION is not what STATUS_ACCESS_DENIED maps onto, but they mean the same
+    CHECK(ntfailure == remote_win32_code(0x20 /*ERROR_SHARING_VIOLATION*/));
+    CHECK(ntfailure != remote_win32_code(0x2 /*ERROR_FILE_NOT_FOUND*/));
+    CHECK(remote_nt_code(static_cast<int32_t>(0xC0000001) /*STATUS_UNSUCCESSFUL*/) != errc::permission_denied);
+    system_code erased(ntfailure);
+    CHECK(erased == errc::permission_denied);
+    CHECK(erased == comwin32);
+    CHECK(strcmp(ntfailure.message().c_str(), "NTSTATUS 0xC0000022 (Permission denied)") == 0);
+    CHECK(strcmp(win32failure.message().c_str(), "Win32 error 5 (Permission denied)") == 0);
+    CHECK(strcmp(comwin32.message().c_str(), "HRESULT 0x80070005 (Permission denied)") == 0);
+    CHECK(strcmp(efail.message().c_str(), "HRESULT 0x80004005") == 0);
+    char buffer[64];
+    CHECK(erased.message_into(buffer, sizeof(buffer)) == strlen("NTSTATUS 0xC0000022 (Permission denied)"));
+    CHECK(strcmp(buffer, "NTSTATUS 0xC0000022 (Permission denied)") == 0);
+    // Codes from Windows round trip through the wire format, and decode without the domain having been registered
+    const system_code remotes[] = {win32failure, ntfailure, comwin32};
+    const status_code_wire_header headers[] = {{remote_win32_code_domain.id(), win32failure.value()},
+                                               {remote_nt_code_domain.id(), ntfailure.value()},
+                                               {remote_com_code_domain.id(), comwin32.value()}};
+    for(size_t n = 0; n < sizeof(remotes) / sizeof(remotes[0]); n++)
+    {
+      const system_code &code = remotes[n];
+      const status_code_wire_header &header = headers[n];
+      system_code decoded = deserialise_status_code(&header, sizeof(header));
+      CHECK(decoded.domain() == code.domain());
+      CHECK(decoded == code);
+      alignas(8) char wire[sizeof(status_code_wire_header)];
+      CHECK(serialise_status_code(wire, sizeof(wire), code) == sizeof(wire));
+      CHECK(deserialise_status_code(wire, sizeof(wire)) == code);
+      CHECK(0 == memcmp(wire, &header, sizeof(header)));
+    }
+    printf("\nRemote NT code failure has value %d (%s) is success %d is failure %d\n",
+           static_cast<int>(ntfailure.value()), ntfailure.message().c_str(), static_cast<int>(ntfailure.success()),
+           static_cast<int>(ntfailure.failure()));
+  }
+
 #ifndef SYSTEM_ERROR2_NOT_POSIX
   // Test posix_code
   constexpr posix_code success9(0), failure9(EACCES);
@@ -847,6 +1065,96 @@ int main()
   CHECK(failure10 == errc::permission_denied);
   CHECK(failure10 == failure1);
   CHECK(failure10 == failure2);
+  {
+    // Domains deriving from a built in domain are asked unless they opt in
+    CHECK(Interrupted_domain.value_info().failure == status_code_domain::value_info_t::failure_kind::opaque);
+    CHECK(Interrupted_domain.value_info().size == sizeof(int));
+    CHECK(Interrupted_domain.value_info().generic_size == 0);
+    system_code interrupted(InterruptedCode(EINTR)), denied(InterruptedCode(EACCES));
+    CHECK(interrupted.success());
+    CHECK(denied.failure());
+    CHECK(denied == errc::permission_denied);
+  }
+  {
+    // Messages for common errno values come from a process wide table, so are stable and not reference counted
+    auto msg1 = failure9.message(), msg2 = failure10.message();
+    CHECK(msg1.data() == msg2.data());
+    CHECK(0 == strcmp(msg1.c_str(), strerror(EACCES)));
+    auto msg3 = posix_code(-1).message();
+    CHECK(msg3.size() > 0);
+    // Short dynamic messages are kept within the string_ref, longer ones on the heap
+    const char *msg3begin = reinterpret_cast<const char *>(&msg3);
+    CHECK(msg3.size() > status_code_domain::inline_string_ref::max_size() ||
+          (msg3.data() >= msg3begin && msg3.data() < msg3begin + sizeof(msg3)));
+    CHECK(0 == strcmp(msg3.c_str(), strerror(-1)));
+  }
+  {
+    status_code_domain::string_ref a = status_code_domain::inline_string_ref("hello");
+    status_code_domain::string_ref b(a), c(std::move(a));
+    CHECK(0 == strcmp(b.c_str(), "hello"));
+    CHECK(0 == strcmp(c.c_str(), "hello"));
+    CHECK(b.size() == 5 && c.size() == 5);
+    CHECK(b.data() != c.data());
+    b = c;
+    CHECK(0 == strcmp(b.c_str(), "hello"));
+    const char *toolong = "0123456789012345678901234567890123456789";
+    status_code_domain::inline_string_ref d(toolong);
+    CHECK(d.size() == status_code_domain::inline_string_ref::max_size());
+    CHECK(0 == strncmp(d.c_str(), toolong, d.size()));
+    CHECK(d.c_str()[d.size()] == 0);
+  }
+  {
+    // Dynamic messages rendered into an arena are kept within the arena
+    char buffer[256];
+    message_arena arena(buffer, sizeof(buffer), 64);
+    auto msg1 = message(posix_code(-1), arena);
+    CHECK(msg1.data() >= buffer && msg1.data() < buffer + sizeof(buffer));
+    CHECK(0 == strcmp(msg1.c_str(), strerror(-1)));
+    status_code_domain::string_ref msg2(msg1);
+    CHECK(msg2.data() == msg1.data());
+    const system_code erased(posix_code(-1));
+    auto msg3 = message(erased, arena);
+    CHECK(msg3.data() >= buffer && msg3.data() < buffer + sizeof(buffer));
+    // Process wide table messages are unaffected
+    CHECK(message(posix_code(EACCES), arena).data() == failure9.message().data());
+    // Overflowing the buffer continues in heap blocks
+    for(int n = 0; n < 16; n++)
+    {
+      auto msg4 = message(posix_code(-2 - n), arena);
+      CHECK(0 == strcmp(msg4.c_str(), strerror(-2 - n)));
+    }
+    // Messages not asked to be rendered into an arena never are
+    auto msg5 = posix_code(-1).message();
+    CHECK(msg5.data() < buffer || msg5.data() >= buffer + sizeof(buffer));
+    arena.release();
+  }
+#if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
+  {
+    // Nor are the messages of exceptions, which may outlive the arena
+    std::exception_ptr ep;
+    {
+      message_arena arena;
+      CHECK(0 == strcmp(message(posix_code(4000), arena).c_str(), strerror(4000)));
+      try
+      {
+        posix_code(4000).throw_exception();
+      }
+      catch(const status_error<void> &e)
+      {
+        CHECK(0 == strcmp(e.what(), strerror(4000)));
+        ep = std::current_exception();
+      }
+    }
+    try
+    {
+      std::rethrow_exception(ep);
+    }
+    catch(const status_error<void> &e)
+    {
+      CHECK(0 == strcmp(e.what(), strerror(4000)));
+    }
+  }
+#endif
 
   // Test error
   error errors[] = {errc::permission_denied, failure1, failure2, std::move(failure3), failure4, failure9,
@@ -860,6 +1168,432 @@ int main()
     CHECK(errors[n] == errc::permission_denied);
   }
 
+  // Test cached equivalence agrees with equivalence, both when filling and when hitting the cache
+  {
+    const generic_code targets[] = {errc::permission_denied, errc::success, errc::timed_out, errc::not_supported};
+    for(int pass = 0; pass < 2; pass++)
+    {
+      for(size_t n = 0; n < sizeof(errors) / sizeof(errors[0]); n++)
+      {
+        for(const auto &target : targets)
+        {
+          CHECK(errors[n].cached_equivalent(target) == errors[n].equivalent(target));
+          CHECK(target.cached_equivalent(errors[n]) == target.equivalent(errors[n]));
+        }
+      }
+      // Many more pairs than there are cache entries, so entries get evicted
+      for(int n = 0; n < 4 * SYSTEM_ERROR2_EQUIVALENCE_CACHE_SIZE; n++)
+      {
+        CHECK(posix_code(n).cached_equivalent(generic_code(static_cast<errc>(n))) ==
+              posix_code(n).equivalent(generic_code(static_cast<errc>(n))));
+      }
+    }
+    // Codes without an integral value are passed through uncached
+    error nested(make_nested_status_code(posix_code(EACCES)));
+    CHECK(nested.cached_equivalent(generic_code(errc::permission_denied)));
+    CHECK(!nested.cached_equivalent(generic_code(errc::timed_out)));
+    CHECK(error().cached_equivalent(error()));
+  }
+  {
+    // The built-in domains are found by id without any setup, and are given distinct dense indices
+    const status_code_domain *builtins[] = {&generic_code_domain, &posix_code_domain, &http_status_code_domain,
+#ifndef _WIN32
+                                            &getaddrinfo_code_domain
+#endif
+    };
+    for(const auto *domain : builtins)
+    {
+      const status_code_domain *found = status_code_domain_from_id(domain->id());
+      CHECK(found != nullptr && *found == *domain);
+      const size_t idx = status_code_domain_index(*domain);
+      CHECK(idx > 0 && idx <= SYSTEM_ERROR2_DOMAIN_REGISTRY_CAPACITY);
+      CHECK(register_status_code_domain(*domain) == idx);
+      CHECK(status_code_domain_from_id(domain->id()) == found);
+    }
+    for(const auto *domain : builtins)
+    {
+      for(const auto *other : builtins)
+      {
+        CHECK((other == domain) == (status_code_domain_index(*other) == status_code_domain_index(*domain)));
+      }
+    }
+    // Other domains must be registered
+    using another_code_domain = quick_status_code_from_enum_code<another_namespace::AnotherCode>::domain_type;
+    CHECK(status_code_domain_from_id(another_code_domain::get().id()) == nullptr);
+    CHECK(status_code_domain_from_id(Code_domain_impl::get().id()) == nullptr);
+    CHECK(status_code_domain_index(Code_domain_impl::get()) == 0);
+    const size_t idx = register_status_code_domain(Code_domain_impl::get());
+    CHECK(idx > 0);
+    CHECK(status_code_domain_index(Code_domain_impl::get()) == idx);
+    CHECK(status_code_domain_from_id(Code_domain_impl::get().id()) == &Code_domain_impl::get());
+    CHECK(status_code_domain_from_id(0x430f120194fc06c7) == nullptr);
+  }
+  {
+    // Codes of the built-in domains and of quick enum domains round trip without being registered first
+    using another_code_domain = quick_status_code_from_enum_code<another_namespace::AnotherCode>::domain_type;
+    CHECK(status_code_domain_index(another_code_domain::get()) == 0);
+    const system_code codes[] = {http_status_code(404),
+#ifndef _WIN32
+                                 getaddrinfo_code(EAI_NONAME),
+#endif
+                                 another_namespace::AnotherCode::goaway};
+    alignas(8) char buffer[sizeof(status_code_wire_header)];
+    for(const auto &code : codes)
+    {
+      CHECK(serialise_status_code(buffer, sizeof(buffer), code) == sizeof(buffer));
+      system_code decoded = deserialise_status_code(buffer, sizeof(buffer));
+      CHECK(!decoded.empty());
+      CHECK(decoded.domain() == code.domain());
+      CHECK(decoded == code);
+    }
+    CHECK(status_code_domain_index(another_code_domain::get()) != 0);
+  }
+  {
+    // Serialised status codes round trip, with or without their message
+    const system_code codes[] = {posix_code(EACCES), posix_code(-1), generic_code(errc::timed_out),
+                                 http_status_code(503), system_code()};
+    alignas(8) char buffer[256];
+    for(const auto &code : codes)
+    {
+      for(bool with_message : {false, true})
+      {
+        const size_t written = serialise_status_code(buffer, sizeof(buffer), code, with_message);
+        CHECK(written == serialised_status_code_size(code, with_message));
+        CHECK(written >= sizeof(status_code_wire_header));
+        serialised_status_code_view view(buffer, written);
+        CHECK(view.valid());
+        CHECK(view.size() == written);
+        CHECK(view.domain_id() == (code.empty() ? 0 : code.domain().id()));
+        CHECK(view.has_message() == (with_message && !code.empty()));
+        if(view.has_message())
+        {
+          CHECK(0 == strcmp(view.message().c_str(), code.message().c_str()));
+          CHECK(view.message().data() > buffer && view.message().data() < buffer + written);
+        }
+        system_code decoded = deserialise_status_code(buffer, written);
+        CHECK(decoded.empty() == code.empty());
+        if(!code.empty())
+        {
+          CHECK(decoded.domain() == code.domain());
+          CHECK(decoded == code);
+          CHECK(0 == strcmp(decoded.message().c_str(), code.message().c_str()));
+        }
+        CHECK(serialise_status_code(buffer, written - 1, code, with_message) == 0);
+        CHECK(!serialised_status_code_view(buffer, written - 1).valid());
+      }
+    }
+    // Codes of unregistered domains keep their id, value and message
+    const status_code_wire_header header{0x430f120194fc06c7, 78};
+    memcpy(buffer, &header, sizeof(header));
+    serialised_status_code_view unknown(buffer, sizeof(header));
+    CHECK(unknown.valid() && unknown.domain() == nullptr);
+    CHECK(unknown.domain_id() == 0x430f120194fc06c7 && unknown.value() == 78);
+    CHECK(unknown.code().empty());
+    // A message which cannot be rendered is serialised empty
+    const UnprintableCode unprintable(errc::timed_out);
+    const size_t unprintable_size = serialised_status_code_size(unprintable, true);
+    CHECK(unprintable_size == sizeof(status_code_wire_header) + sizeof(uint32_t) + 1);
+    CHECK(serialise_status_code(buffer, sizeof(buffer), unprintable, true) == unprintable_size);
+    CHECK(serialised_status_code_view(buffer, unprintable_size).message().size() == 0);
+    // Codes without an integral value cannot be serialised
+    error nested(make_nested_status_code(posix_code(EACCES)));
+    CHECK(serialised_status_code_size(nested) == 0);
+    CHECK(serialise_status_code(buffer, sizeof(buffer), nested, true) == 0);
+  }
+  {
+    // Packed status codes round trip losslessly
+    const system_code codes[] = {posix_code(EACCES), posix_code(-1), generic_code(errc::timed_out),
+                                 generic_code(errc::success), http_status_code(503)};
+    const long long values[] = {EACCES, -1, static_cast<long long>(errc::timed_out), 0, 503};
+    for(size_t n = 0; n < sizeof(codes) / sizeof(codes[0]); n++)
+    {
+      const system_code &code = codes[n];
+      CHECK(packed_status_code::can_pack(code));
+      packed_status_code packed(code);
+      CHECK(!packed.empty());
+      CHECK(packed.domain() == &code.domain());
+      CHECK(packed.value() == values[n]);
+      CHECK(packed.failure() == code.failure());
+      CHECK(packed.success() == code.success());
+      CHECK(packed == packed_status_code::from_bits(packed.bits()));
+      system_code unpacked = packed.unpack();
+      CHECK(unpacked.domain() == code.domain());
+      CHECK(unpacked.value() == code.value());
+      CHECK(unpacked == code);
+    }
+    CHECK(packed_status_code(codes[0]).domain_index() == packed_status_code(posix_code(ENOENT)).domain_index());
+    CHECK(packed_status_code(codes[0]).domain_index() != packed_status_code(codes[2]).domain_index());
+    CHECK(packed_status_code(codes[0]) != packed_status_code(posix_code(ENOENT)));
+    CHECK(packed_status_code(system_code()).empty());
+    CHECK(packed_status_code().unpack().empty());
+    CHECK(!packed_status_code().failure() && !packed_status_code().success());
+    // Codes without an integral value cannot be packed
+    error nested(make_nested_status_code(posix_code(EACCES)));
+    CHECK(!packed_status_code::can_pack(nested));
+    CHECK(packed_status_code(nested).empty());
+  }
+  {
+    // The flight recorder keeps the most recent errors of each thread
+    struct recorded
+    {
+      size_t ring;
+      flight_recorder_record rec;
+    };
+    auto recorded_errors = [] {
+      std::vector<recorded> ret;
+      flight_recorder::for_each([&](size_t ring, const flight_recorder_record &rec) { ret.push_back({ring, rec}); });
+      return ret;
+    };
+    CHECK(flight_recorder::thread_init());
+    CHECK(recorded_errors().empty());
+    SYSTEM_ERROR2_FLIGHT_RECORD(posix_code(EACCES));
+    flight_recorder::record(http_status_code(503));
+    flight_recorder::record(system_code());
+    auto errors1 = recorded_errors();
+    CHECK(errors1.size() == 2);
+    if(errors1.size() == 2)
+    {
+      CHECK(errors1[0].rec.sequence == 0 && errors1[1].rec.sequence == 1);
+      CHECK(errors1[0].rec.domain_id == posix_code_domain.id() && errors1[0].rec.value == EACCES);
+      CHECK(errors1[0].rec.file != nullptr && 0 == strcmp(errors1[0].rec.file, __FILE__) && errors1[0].rec.line > 0);
+      CHECK(errors1[1].rec.domain_id == http_status_code_domain.id() && errors1[1].rec.value == 503);
+      CHECK(errors1[1].rec.file == nullptr && errors1[1].rec.line == 0);
+      CHECK(errors1[0].rec.timestamp > 0 && errors1[1].rec.timestamp >= errors1[0].rec.timestamp);
+    }
+    // Only the most recent are kept
+    for(int n = 0; n < SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE + 10; n++)
+    {
+      flight_recorder::record(posix_code(1000 + n));
+    }
+    auto errors2 = recorded_errors();
+    CHECK(errors2.size() == SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE);
+    CHECK(!errors2.empty() && errors2.back().rec.value == 1000 + SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE + 9);
+    // Rings of exited threads are kept, and reused by new threads
+    std::thread([] { flight_recorder::record(generic_code(errc::timed_out)); }).join();
+    auto errors3 = recorded_errors();
+    CHECK(errors3.size() == SYSTEM_ERROR2_FLIGHT_RECORDER_SIZE + 1);
+    size_t exited_ring = 0;
+    for(const auto &i : errors3)
+    {
+      if(i.rec.domain_id == generic_code_domain.id())
+      {
+        exited_ring = i.ring;
+        CHECK(i.rec.value == static_cast<int>(errc::timed_out));
+        CHECK(i.ring != errors2.back().ring);
+      }
+    }
+    std::thread([] { SYSTEM_ERROR2_FLIGHT_RECORD(generic_code(errc::io_error)); }).join();
+    for(const auto &i : recorded_errors())
+    {
+      if(i.rec.domain_id == generic_code_domain.id() && i.rec.value == static_cast<int>(errc::io_error))
+      {
+        CHECK(i.ring == exited_ring && i.rec.sequence == 1);
+      }
+    }
+    char buffer[65536];
+    const size_t written = flight_recorder::dump(buffer, sizeof(buffer) - 1);
+    buffer[written] = 0;
+    CHECK(written > 0 && buffer[written - 1] == '\n');
+    CHECK(strstr(buffer, "value 5 at ") != nullptr);
+    CHECK(strstr(buffer, "value 1073\n") != nullptr);
+    CHECK(flight_recorder::dump(buffer, 10) == 10);
+#ifndef _WIN32
+    FILE *f = tmpfile();
+    CHECK(f != nullptr && flight_recorder::dump(fileno(f)));
+    if(f != nullptr)
+    {
+      CHECK(static_cast<size_t>(lseek(fileno(f), 0, SEEK_CUR)) == written);
+      fclose(f);
+    }
+#endif
+  }
+
+  {
+    // The first failure of many racing threads is kept, and the others cancelled
+    atomic_status_code first;
+    CHECK(first.empty() && !first.cancelled() && first.load().empty());
+    system_code empty;
+    CHECK(!first.try_set_first(std::move(empty)));
+    CHECK(first.empty() && !first.cancelled());
+    std::vector<std::thread> threads;
+    std::atomic<unsigned> winners(0), skipped(0);
+    for(int n = 0; n < 8; n++)
+    {
+      threads.emplace_back([&, n] {
+        for(int i = 0; i < 1000; i++)
+        {
+          if(first.cancelled())
+          {
+            skipped.fetch_add(1, std::memory_order_relaxed);
+            break;
+          }
+        }
+        if(first.try_set_first(posix_code(1000 + n)))
+        {
+          winners.fetch_add(1, std::memory_order_relaxed);
+        }
+        const system_code seen = first.load();
+        if(seen.empty() || seen.domain() != posix_code_domain)
+        {
+          winners.fetch_add(100, std::memory_order_relaxed);
+        }
+      });
+    }
+    for(auto &t : threads)
+    {
+      t.join();
+    }
+    CHECK(winners == 1);
+    CHECK(first.cancelled());
+    const system_code won = first.load();
+    CHECK(won.domain() == posix_code_domain);
+    system_code late(posix_code(EACCES));
+    CHECK(!first.try_set_first(std::move(late)));
+    CHECK(late == errc::permission_denied);
+    CHECK(first.load() == won);
+    // Exchange and reset hand back ownership of the stored code
+    system_code old = first.exchange(generic_code(errc::timed_out));
+    CHECK(old == won);
+    CHECK(first.load() == errc::timed_out);
+    old = first.reset();
+    CHECK(old == errc::timed_out);
+    CHECK(first.empty() && !first.cancelled());
+    first.cancel();
+    CHECK(first.cancelled());
+    // Codes owning payloads are cloned by load(), and destroyed with the atomic
+    atomic_status_code nested(make_nested_status_code(posix_code(EACCES)));
+    CHECK(!nested.empty() && !nested.cancelled());
+    CHECK(nested.load() == errc::permission_denied);
+    CHECK(nested.load() == nested.load());
+    old = nested.exchange(make_nested_status_code(posix_code(ENOENT)));
+    CHECK(old == errc::permission_denied);
+    CHECK(nested.load() == errc::no_such_file_or_directory);
+  }
+
+  {
+    // Exact hashing and equality are by domain and value, not semantic
+    const exact_hash hash;
+    const exact_equal equal;
+    const system_code erased(posix_code(EACCES));
+    CHECK(posix_code(EACCES) == generic_code(errc::permission_denied));
+    CHECK(!equal(posix_code(EACCES), generic_code(errc::permission_denied)));
+    CHECK(equal(posix_code(EACCES), erased) && hash(posix_code(EACCES)) == hash(erased));
+    CHECK(!equal(posix_code(EACCES), posix_code(ENOENT)));
+    CHECK(!equal(posix_code(-1), posix_code(0)));
+    CHECK(equal(system_code(), posix_code()) && hash(system_code()) == hash(posix_code()));
+    CHECK(!equal(system_code(), posix_code(0)));
+    const system_code nested1(make_nested_status_code(posix_code(EACCES)));
+    const system_code nested2(make_nested_status_code(posix_code(EACCES)));
+    const system_code nested3(nested1.clone());
+    CHECK(equal(nested1, nested1) && !equal(nested1, nested2));
+    // A clone of a nested code points to its own copy of the nested code
+    CHECK(!equal(nested1, nested3) && nested1 == nested3);
+    std::unordered_map<system_code, int, exact_hash, exact_equal> unordered;
+    unordered[posix_code(EACCES)] = 1;
+    unordered[generic_code(errc::permission_denied)] = 2;
+    CHECK(unordered.size() == 2 && unordered.find(erased)->second == 1);
+
+    // A histogram of failures
+    status_code_map<int> histogram;
+    CHECK(histogram.empty() && histogram.find(erased) == histogram.end() && histogram.count(erased) == 0);
+    for(int n = 0; n < 1000; n++)
+    {
+      histogram[posix_code(n % 37)]++;
+      if(n % 3 == 0)
+      {
+        histogram[generic_code(static_cast<errc>(n % 11))]++;
+      }
+    }
+    CHECK(histogram.size() == 37 + 11);
+    CHECK(histogram.count(erased) == 1 && histogram.find(posix_code(EACCES))->second == 27);
+    CHECK(histogram.count(posix_code(37)) == 0);
+    CHECK(histogram[generic_code(errc::success)] == 31);
+    int total = 0;
+    for(const auto &entry : histogram)
+    {
+      total += entry.second;
+      CHECK(histogram.find(entry.first)->second == entry.second);
+    }
+    CHECK(total == 1000 + 334);
+    for(int n = 0; n < 37; n += 2)
+    {
+      CHECK(histogram.erase(posix_code(n)) == 1);
+      CHECK(histogram.erase(posix_code(n)) == 0);
+    }
+    CHECK(histogram.size() == 18 + 11);
+    for(int n = 0; n < 37; n++)
+    {
+      const auto it = histogram.find(posix_code(n));
+      const bool erased_entry = (n % 2 == 0);
+      const int expected = (n < 1000 % 37) ? 28 : 27;
+      CHECK(erased_entry ? (it == histogram.end()) : (it != histogram.end() && it->second == expected));
+    }
+    status_code_map<int> moved(std::move(histogram));
+    CHECK(histogram.empty() && moved.size() == 18 + 11);
+    moved.clear();
+    CHECK(moved.empty() && moved.begin() == moved.end() && moved.count(erased) == 0);
+  }
+
+  {
+    // Generic codes looked up in domains' tables agree with their _do_generic_code()
+    const errc conds[] = {errc::success,
+                          errc::permission_denied,
+                          errc::no_such_file_or_directory,
+                          errc::timed_out,
+                          errc::invalid_argument,
+                          errc::no_such_device_or_address,
+                          errc::resource_unavailable_try_again};
+    CHECK(posix_code_domain.value_info().generic_size != 0);
+    CHECK(http_status_code_domain.value_info().generic_size == ((__cplusplus >= 201400) ? 500 : 0));
+    for(int v = -300; v < 700; v++)
+    {
+      for(const errc e : conds)
+      {
+        const generic_code g(e);
+        CHECK((http_status_code(v) == g) == (detail::http_status_generic_code(v) == e));
+        CHECK((getaddrinfo_code(v) == g) == (detail::getaddrinfo_generic_code(v) == e));
+        CHECK((posix_code(v) == g) == (v == static_cast<int>(e)));
+        CHECK((std_error_code(std::error_code(v, std::generic_category())) == g) == (v == static_cast<int>(e)));
+        CHECK((std_error_code(std::error_code(v, std::system_category())) == g) == (v == static_cast<int>(e)));
+      }
+    }
+    CHECK(http_status_code(404) == errc::no_such_file_or_directory);
+    CHECK(getaddrinfo_code(EAI_AGAIN) == errc::resource_unavailable_try_again);
+    CHECK(system_code(getaddrinfo_code(EAI_NONAME)) == errc::no_such_device_or_address);
+    CHECK(std_error_code(std::make_error_code(std::errc::timed_out)) == errc::timed_out);
+  }
+
+  // Test message_into()
+  {
+    char buffer[256];
+    const system_code codes[] = {posix_code(EACCES),
+                                 posix_code(4000),
+                                 generic_code(errc::timed_out),
+                                 http_status_code(404),
+                                 getaddrinfo_code(EAI_NONAME),
+                                 std_error_code(std::error_code(ENOENT, std::generic_category())),
+                                 std_error_code(std::error_code(ENOENT, std::system_category())),
+                                 make_nested_status_code(posix_code(EINVAL))};
+    for(const auto &sc : codes)
+    {
+      const auto msg = sc.message();
+      CHECK(sc.message_into(buffer, sizeof(buffer)) == msg.size());
+      CHECK(strcmp(buffer, msg.c_str()) == 0);
+      // Truncated to fit, and still null terminated
+      CHECK(sc.message_into(buffer, 5) == 4);
+      CHECK(strncmp(buffer, msg.c_str(), 4) == 0);
+      CHECK(buffer[4] == 0);
+      buffer[0] = 'x';
+      CHECK(sc.message_into(buffer, 0) == 0);
+      CHECK(buffer[0] == 'x');
+    }
+    CHECK(system_code().message_into(buffer, sizeof(buffer)) == 7);
+    CHECK(strcmp(buffer, "(empty)") == 0);
+    // A message which cannot be rendered is written empty
+    CHECK(UnprintableCode(errc::timed_out).message_into(buffer, sizeof(buffer)) == 0);
+    CHECK(buffer[0] == 0);
+  }
+
   // Test mixin
   {
     errno = 99;
@@ -903,6 +1637,9 @@ int main()
     system_code ec1(error_codes[0]), ec2(error_codes[1]);
     CHECK(ec1 == errc::permission_denied);
     CHECK(ec2 == errc::result_out_of_range);
+    char buffer[256];
+    CHECK(ec2.message_into(buffer, sizeof(buffer)) == ec2.message().size());
+    CHECK(strcmp(buffer, ec2.message().c_str()) == 0);
     {
       struct error_info
       {
@@ -912,6 +1649,29 @@ int main()
       static_assert(std::is_constructible<erased_status_code<error_info>, std::error_code>::value,
                     "An erased status code is not constructible from a std::error_code");
     }
+    // The category registry used to be limited to 64 categories
+    {
+      struct many_category final : std::error_category
+      {
+        virtual const char *name() const noexcept override { return "many"; }
+        virtual std::string message(int c) const override { return std::to_string(c); }
+      };
+      static const many_category categories[200];
+      const status_code_domain *domains[200];
+      for(size_t n = 0; n < 200; n++)
+      {
+        std_error_code ec(std::error_code(static_cast<int>(n), categories[n]));
+        domains[n] = &ec.domain();
+        CHECK(&ec.category() == &categories[n]);
+        CHECK(std::to_string(n) == ec.message().c_str());
+      }
+      for(size_t n = 0; n < 200; n++)
+      {
+        std_error_code ec(std::error_code(1, categories[n]));
+        CHECK(&ec.domain() == domains[n]);
+        CHECK(n == 0 || domains[n] != domains[n - 1]);
+      }
+    }
   }
 
 #ifdef TEST_BOOST_SYSTEM_CODE
@@ -930,6 +1690,9 @@ int main()
     system_code ec1(error_codes[0]), ec2(error_codes[1]);
     CHECK(ec1 == errc::permission_denied);
     CHECK(ec2 == errc::result_out_of_range);
+    char buffer[256];
+    CHECK(ec2.message_into(buffer, sizeof(buffer)) == ec2.message().size());
+    CHECK(strcmp(buffer, ec2.message().c_str()) == 0);
     {
       struct error_info
       {
@@ -955,6 +1718,36 @@ int main()
   CHECK(*get_if<posix_code>(&success11) == success9);
   CHECK(get_if<StatusCode>(&success11) == nullptr);
   CHECK(get_id(success11) == success9.domain().id());
+  {
+    // Shared nested codes share their payload between clones
+    system_code shared2;
+    {
+      system_code shared1(make_shared_nested_status_code(failure9));
+      shared2 = shared1.clone();
+      CHECK(shared1 == errc::permission_denied);
+      CHECK(get_if<posix_code>(&shared1) == get_if<posix_code>(&shared2));
+    }
+    CHECK(shared2 == errc::permission_denied);
+    CHECK(shared2.failure());
+    CHECK(*get_if<posix_code>(&shared2) == failure9);
+    CHECK(get_id(shared2) == failure9.domain().id());
+    CHECK(0 == strcmp(shared2.message().c_str(), failure9.message().c_str()));
+    // Pooled nested codes reuse blocks freed by this thread
+    const posix_code *first;
+    {
+      system_code pooled(make_nested_status_code(failure9, thread_caching_pool_allocator<posix_code>()));
+      first = get_if<posix_code>(&pooled);
+      system_code pooled2(pooled.clone());
+      CHECK(get_if<posix_code>(&pooled2) != first);
+      CHECK(pooled2 == errc::permission_denied);
+    }
+    system_code pooled3(make_nested_status_code(failure9, thread_caching_pool_allocator<posix_code>()));
+    const posix_code *second = get_if<posix_code>(&pooled3);
+    CHECK(second == first);
+    system_code pooled4(make_shared_nested_status_code(failure9, thread_caching_pool_allocator<posix_code>()));
+    system_code pooled5(pooled4.clone());
+    CHECK(pooled5 == errc::permission_denied);
+  }
 #endif
 
 #if defined(_CPPUNWIND) || defined(__EXCEPTIONS) || defined(STANDARDESE_IS_IN_THE_HOUSE)
@@ -971,6 +1764,83 @@ int main()
             return system_code_from_exception();
           }
         }());
+  {
+    struct derived_out_of_range : std::out_of_range
+    {
+      derived_out_of_range()
+          : std::out_of_range("derived")
+      {
+      }
+    };
+    struct registered_error : std::exception
+    {
+      int value{EACCES};
+    };
+    struct declined_error : std::runtime_error
+    {
+      declined_error()
+          : std::runtime_error("declined")
+      {
+      }
+    };
+    CHECK(register_system_code_from_exception<registered_error>(
+    [](const std::exception &e) -> system_code
+    { return generic_code(static_cast<errc>(static_cast<const registered_error &>(e).value)); }));
+    CHECK(register_system_code_from_exception<declined_error>([](const std::exception & /*unused*/) -> system_code
+                                                              { return {}; }));
+    auto from = [](std::exception_ptr ep) { return system_code_from_exception(std::move(ep)); };
+    // Standard and exactly registered types
+    CHECK(from(std::make_exception_ptr(std::out_of_range("x"))) == errc::result_out_of_range);
+    CHECK(from(std::make_exception_ptr(std::bad_alloc())) == errc::not_enough_memory);
+    CHECK(from(std::make_exception_ptr(std::system_error(ENOENT, std::generic_category()))) ==
+          errc::no_such_file_or_directory);
+    CHECK(from(std::make_exception_ptr(registered_error())) == errc::permission_denied);
+    // Derived types and declined mappings fall back to the standard base classes
+    CHECK(from(std::make_exception_ptr(derived_out_of_range())) == errc::result_out_of_range);
+    CHECK(from(std::make_exception_ptr(declined_error())) == errc::resource_unavailable_try_again);
+    CHECK(from(std::make_exception_ptr(5)) == errc::resource_unavailable_try_again);
+    // Which is remembered for next time
+    CHECK(from(std::make_exception_ptr(derived_out_of_range())) == errc::result_out_of_range);
+    CHECK(from(std::make_exception_ptr(declined_error())) == errc::resource_unavailable_try_again);
+    // A std::system_error of an unknown category is not matched, but is still consumed
+    struct unknown_category : std::error_category
+    {
+      const char *name() const noexcept override { return "unknown"; }
+      std::string message(int /*unused*/) const override { return "unknown"; }
+    };
+    static unknown_category category;
+    for(int n = 0; n < 2; n++)
+    {
+      std::exception_ptr ep = std::make_exception_ptr(std::system_error(ENOENT, category));
+      CHECK(system_code_from_exception(std::move(ep)) == errc::resource_unavailable_try_again);
+      CHECK(!ep);
+    }
+  }
+  // Test that the message of a thrown status code is rendered upon first use, then kept
+  try
+  {
+    throw generic_error(errc::permission_denied);
+  }
+  catch(const status_error<void> &e)
+  {
+    const char *msg = e.what();
+    CHECK(msg == e.what());
+    CHECK(0 == strcmp(msg, e.code().message().c_str()));
+  }
+  {
+    const generic_error e1(errc::timed_out), e2(e1);
+    const char *msg = e1.what();
+    const generic_error e3(e1);
+    CHECK(0 == strcmp(msg, e2.what()));
+    CHECK(0 == strcmp(msg, e3.what()));
+  }
+  {
+    // A message which cannot be rendered does not terminate what(), and is retried
+    const status_error<Unprintable_domain_impl> e(UnprintableCode(errc::timed_out));
+    CHECK(e.what() != nullptr);
+    CHECK(e.what() != nullptr);
+    CHECK(e.code().value() == errc::timed_out);
+  }
 #endif
 
 #if __cplusplus >= 202000 || _HAS_CXX20
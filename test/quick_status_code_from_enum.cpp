@@ -0,0 +1,167 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+// We deliberately look up values missing from the mapping tables
+#define SYSTEM_ERROR2_QUICK_STATUS_CODE_FROM_ENUM_ASSERT_ON_MISSING_MAPPING_TABLE_ENTRIES 0
+
+#include "status-code/system_error2.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#define CHECK(expr)                                                                                                    \
+  if(!(expr))                                                                                                          \
+  {                                                                                                                    \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                           \
+    retcode = 1;                                                                                                       \
+  }
+
+// Values close together, so indexed by an array
+enum class DenseCode : unsigned char
+{
+  success = 3,
+  e4,
+  e5,
+  e6,
+  e7,
+  e8,
+  e9,
+  e10,
+  e11,
+  e12,
+  missing,
+  e14,
+  e15,
+  e16
+};
+// Values far apart and signed, so indexed by a hash table
+enum class SparseCode : long long
+{
+  success = 0,
+  negative = -1000000000000LL,
+  e1 = 1000,
+  e2 = 2000,
+  e3 = 3000000,
+  e4 = 4000000000LL,
+  e5 = -5,
+  e6 = 6 << 20,
+  e7 = 7 << 24,
+  e8 = 8,
+  missing = 9
+};
+
+SYSTEM_ERROR2_NAMESPACE_BEGIN
+template <> struct quick_status_code_from_enum<DenseCode> : quick_status_code_from_enum_defaults<DenseCode>
+{
+  static constexpr const auto domain_name = "Dense Code";
+  static constexpr const auto domain_uuid = "{1c0e5a3b-86d4-4c52-9e3f-3b8e3f1d2a10}";
+  static const std::initializer_list<mapping> &value_mappings()
+  {
+    static const std::initializer_list<mapping> v = {
+    {DenseCode::success, "success", {errc::success}},             //
+    {DenseCode::e4, "e4", {errc::invalid_argument}},              //
+    {DenseCode::e5, "e5", {errc::permission_denied}},             //
+    {DenseCode::e6, "e6", {}},                                    //
+    {DenseCode::e7, "e7", {errc::timed_out}},                     //
+    {DenseCode::e8, "e8", {errc::io_error}},                      //
+    {DenseCode::e9, "e9", {errc::io_error, errc::timed_out}},     //
+    {DenseCode::e9, "e9 duplicate", {errc::success}},             //
+    {DenseCode::e10, "e10", {errc::success}},                     //
+    {DenseCode::e11, "e11", {errc::file_exists}},                 //
+    {DenseCode::e12, "e12", {errc::file_too_large}},              //
+    {DenseCode::e14, "e14", {errc::no_space_on_device}},          //
+    {DenseCode::e15, "e15", {errc::not_a_directory}},             //
+    {DenseCode::e16, "e16", {errc::is_a_directory}},              //
+    };
+    return v;
+  }
+};
+template <> struct quick_status_code_from_enum<SparseCode> : quick_status_code_from_enum_defaults<SparseCode>
+{
+  static constexpr const auto domain_name = "Sparse Code";
+  static constexpr const auto domain_uuid = "{7f2b9c1d-4e6a-4b3f-8d21-5c9e0a7b6f42}";
+  static const std::initializer_list<mapping> &value_mappings()
+  {
+    static const std::initializer_list<mapping> v = {
+    {SparseCode::success, "success", {errc::success}},            //
+    {SparseCode::negative, "negative", {errc::invalid_argument}}, //
+    {SparseCode::e1, "e1", {errc::permission_denied}},            //
+    {SparseCode::e2, "e2", {}},                                   //
+    {SparseCode::e3, "e3", {errc::timed_out}},                    //
+    {SparseCode::e4, "e4", {errc::io_error}},                     //
+    {SparseCode::e5, "e5", {errc::success}},                      //
+    {SparseCode::e6, "e6", {errc::file_exists}},                  //
+    {SparseCode::e7, "e7", {errc::file_too_large}},               //
+    {SparseCode::e8, "e8", {errc::io_error, errc::timed_out}},    //
+    };
+    return v;
+  }
+};
+SYSTEM_ERROR2_NAMESPACE_END
+
+int main()
+{
+  using namespace SYSTEM_ERROR2_NAMESPACE;
+  int retcode = 0;
+
+  using dense_code = quick_status_code_from_enum_code<DenseCode>;
+  CHECK(dense_code(DenseCode::success).success());
+  CHECK(dense_code(DenseCode::e6).failure());
+  CHECK(dense_code(DenseCode::e10).success());
+  CHECK(dense_code(DenseCode::e16).failure());
+  CHECK(dense_code(DenseCode::e5) == errc::permission_denied);
+  CHECK(dense_code(DenseCode::e16) == errc::is_a_directory);
+  CHECK(dense_code(DenseCode::e15) != errc::is_a_directory);
+  CHECK(strcmp(dense_code(DenseCode::e14).message().c_str(), "e14") == 0);
+  // The first of duplicate entries wins, as it always has
+  CHECK(strcmp(dense_code(DenseCode::e9).message().c_str(), "e9") == 0);
+  CHECK(dense_code(DenseCode::e9).failure());
+  CHECK(dense_code(DenseCode::e9) == errc::timed_out);
+  // Values not in the mapping table
+  CHECK(dense_code(DenseCode::missing).failure());
+  CHECK(strcmp(dense_code(DenseCode::missing).message().c_str(), "unknown") == 0);
+  CHECK(dense_code(static_cast<DenseCode>(0)).failure());
+  CHECK(dense_code(static_cast<DenseCode>(255)).failure());
+
+  using sparse_code = quick_status_code_from_enum_code<SparseCode>;
+  CHECK(sparse_code(SparseCode::success).success());
+  CHECK(sparse_code(SparseCode::e5).success());
+  CHECK(sparse_code(SparseCode::negative).failure());
+  CHECK(sparse_code(SparseCode::negative) == errc::invalid_argument);
+  CHECK(sparse_code(SparseCode::e4) == errc::io_error);
+  CHECK(sparse_code(SparseCode::e8) == errc::timed_out);
+  CHECK(sparse_code(SparseCode::e7) != errc::io_error);
+  CHECK(strcmp(sparse_code(SparseCode::e6).message().c_str(), "e6") == 0);
+  CHECK(strcmp(sparse_code(SparseCode::negative).message().c_str(), "negative") == 0);
+  CHECK(sparse_code(SparseCode::missing).failure());
+  CHECK(strcmp(sparse_code(SparseCode::missing).message().c_str(), "unknown") == 0);
+  for(long long n = -20; n < 20; n++)
+  {
+    const auto v = static_cast<SparseCode>(n);
+    const bool known = (v == SparseCode::success || v == SparseCode::e5 || v == SparseCode::e8);
+    CHECK(known == (strcmp(sparse_code(v).message().c_str(), "unknown") != 0));
+  }
+
+  return retcode;
+}
@@ -28,6 +28,7 @@ http://www.boost.org/LICENSE_1_0.txt)
 
 #include <cstdio>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 
 /* Most of this test suite was ported over from Boost.Outcome's
@@ -198,7 +199,7 @@ int main()
 
     result<int> a(5);
     result<int> b(generic_code{errc::invalid_argument});
-    std::cout << sizeof(a) << std::endl;  // 32 bytes
+    std::cout << sizeof(a) << std::endl;  // 16 bytes
     if(false)                             // NOLINT
     {
       b.assume_value();
@@ -270,6 +271,92 @@ int main()
     BOOST_CHECK(i.has_error());
   }
 
+  // Test the error's domain pointer doubles as the discriminant
+  {
+    static_assert(sizeof(result<int>) == sizeof(error), "");
+    static_assert(sizeof(result<void>) == sizeof(error), "");
+    static_assert(sizeof(result<void *>) == sizeof(error), "");
+    result<void *> a(nullptr), b(errc::invalid_argument);
+    BOOST_CHECK(a.has_value());
+    BOOST_CHECK(a.value() == nullptr);
+    BOOST_CHECK(b.has_error());
+    // Moving out an error leaves an empty error behind, which is still an error
+    result<int> c(std::move(b).error());
+    BOOST_CHECK(b.has_error());
+    BOOST_CHECK(b.error().empty());
+    BOOST_CHECK(c.error() == errc::invalid_argument);
+    result<int> d(std::move(c));
+    BOOST_CHECK(c.has_error());
+    BOOST_CHECK(d.error() == errc::invalid_argument);
+    error moved(std::move(d.error()));
+    BOOST_CHECK(d.has_error());
+    BOOST_CHECK(d.error().empty());
+    d.error() = std::move(moved);
+    BOOST_CHECK(d.error() == errc::invalid_argument);
+    // Assignment between alternatives
+    result<std::string> e("niall"), f(errc::timed_out);
+    e = std::move(f);
+    BOOST_CHECK(e.error() == errc::timed_out);
+    f = result<std::string>("douglas");
+    BOOST_CHECK(f.value() == "douglas");
+    e.swap(f);
+    BOOST_CHECK(e.value() == "douglas");
+    BOOST_CHECK(f.error() == errc::timed_out);
+    // Converting construction
+    result<long> g(result<int>(5)), h(result<int>(errc::timed_out));
+    BOOST_CHECK(g.value() == 5);
+    BOOST_CHECK(h.error() == errc::timed_out);
+    BOOST_CHECK(g == result<long>(5));
+    BOOST_CHECK(g != h);
+  }
+#ifdef __cpp_exceptions
+  {
+    // Assigning a value whose construction throws leaves the error in place
+    struct throws_on_move
+    {
+      throws_on_move() = default;
+      throws_on_move(throws_on_move &&) { throw std::runtime_error("move"); }  // NOLINT
+      throws_on_move &operator=(throws_on_move &&) = default;
+    };
+    result<throws_on_move> a(errc::timed_out), b(in_place_type<throws_on_move>);
+    BOOST_CHECK_THROW(a = std::move(b), const std::runtime_error &);
+    BOOST_CHECK(a.has_error());
+    BOOST_CHECK(a.error() == errc::timed_out);
+  }
+#endif
+
+  // Only results of trivially copyable types are trivially relocatable, so others are moved as their type says
+  {
+    struct self_referencing
+    {
+      const self_referencing *self{this};
+      self_referencing() = default;
+      self_referencing(self_referencing && /*unused*/) noexcept {}
+      self_referencing &operator=(self_referencing && /*unused*/) noexcept { return *this; }
+      ~self_referencing() { self = nullptr; }
+      bool valid() const noexcept { return self == this; }
+    };
+    static_assert(std::is_base_of_v<SYSTEM_ERROR2_NAMESPACE::detail::result_storage<int, true>, result<int>>, "");
+    static_assert(std::is_base_of_v<SYSTEM_ERROR2_NAMESPACE::detail::result_storage<void *, true>, result<void *>>,
+                  "");
+    static_assert(
+    std::is_base_of_v<SYSTEM_ERROR2_NAMESPACE::detail::result_storage<std::string, false>, result<std::string>>, "");
+    static_assert(std::is_base_of_v<SYSTEM_ERROR2_NAMESPACE::detail::result_storage<self_referencing, false>,
+                                    result<self_referencing>>,
+                  "");
+    // Passed through a call which cannot be inlined, so a result relocated by copying its bits would be detected
+    result<self_referencing> (*volatile pass)(result<self_referencing>) = [](result<self_referencing> r) { return r; };
+    result<self_referencing> a(in_place_type<self_referencing>);
+    BOOST_CHECK(a.value().valid());
+    result<self_referencing> b(pass(std::move(a)));
+    BOOST_CHECK(b.value().valid());
+    result<self_referencing> c(pass(result<self_referencing>(errc::timed_out)));
+    BOOST_CHECK(c.error() == errc::timed_out);
+    result<int> (*volatile pass_int)(result<int>) = [](result<int> r) { return r; };
+    BOOST_CHECK(pass_int(result<int>(5)).value() == 5);
+    BOOST_CHECK(pass_int(result<int>(errc::timed_out)).error() == errc::timed_out);
+  }
+
   // Test direct use of error code enum works
   {
     /*constexpr*/ result<int> a(5), b(errc::invalid_argument);
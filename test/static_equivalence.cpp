@@ -0,0 +1,211 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#include "status-code/http_status_code.hpp"
+#include "status-code/remote_com_code.hpp"
+#include "status-code/system_error2.hpp"
+#ifndef _WIN32
+#include "status-code/getaddrinfo_code.hpp"
+#endif
+
+#include <cerrno>
+#include <cstdio>
+#include <vector>
+
+#define CHECK(expr)                                                                                                    \
+  if(!(expr))                                                                                                          \
+  {                                                                                                                    \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                           \
+    retcode = 1;                                                                                                       \
+  }
+
+using namespace SYSTEM_ERROR2_NAMESPACE;
+
+static_assert(traits::static_equivalence<_posix_code_domain, _generic_code_domain>::value, "");
+static_assert(traits::static_equivalence<_http_status_code_domain, _generic_code_domain>::value, "");
+static_assert(!traits::static_equivalence<_generic_code_domain, _posix_code_domain>::value, "");
+static_assert(traits::static_equivalence<_remote_nt_code_domain, _remote_win32_code_domain>::value, "");
+
+#if __cplusplus >= 201400 || _MSC_VER >= 1910 /* VS2017 */
+// Being usable in a constant expression proves that no virtual function of a domain is called
+static_assert(generic_code(errc::invalid_argument) == generic_code(errc::invalid_argument), "");
+static_assert(generic_code(errc::invalid_argument) != generic_code(errc::timed_out), "");
+static_assert(posix_code(EINVAL) == generic_code(errc::invalid_argument), "");
+static_assert(generic_code(errc::invalid_argument) == posix_code(EINVAL), "");
+static_assert(posix_code(EINVAL) != posix_code(ENOENT), "");
+static_assert(posix_code(EINVAL) == errc::invalid_argument, "");
+static_assert(errc::invalid_argument != posix_code(ENOENT), "");
+static_assert(http_status_code(404) == errc::no_such_file_or_directory, "");
+static_assert(http_status_code(404) != http_status_code(403), "");
+static_assert(generic_code() == posix_code(), "");
+static_assert(generic_code() != posix_code(0), "");
+static_assert(remote_nt_code(static_cast<int32_t>(0xC0000022)) == errc::permission_denied, "");
+static_assert(remote_win32_code(5) == remote_nt_code(static_cast<int32_t>(0xC0000022)), "");
+static_assert(remote_com_code(static_cast<int32_t>(0x80070005)) == errc::permission_denied, "");
+#endif
+
+// Compiled with -O2 -S by the codegen test, which checks that the typed comparisons contain no calls
+extern "C" bool static_equivalence_posix_generic(const posix_code &a, const generic_code &b)
+{
+  return a == b;
+}
+extern "C" bool static_equivalence_generic_posix(const generic_code &a, const posix_code &b)
+{
+  return a == b;
+}
+extern "C" bool static_equivalence_posix_errc(const posix_code &a, errc b)
+{
+  return a != b;
+}
+extern "C" bool static_equivalence_http_generic(const http_status_code &a, const generic_code &b)
+{
+  return a == b;
+}
+extern "C" bool static_equivalence_remote_nt_generic(const remote_nt_code &a, const generic_code &b)
+{
+  return a == b;
+}
+extern "C" bool static_equivalence_remote_nt_win32(const remote_nt_code &a, const remote_win32_code &b)
+{
+  return a == b;
+}
+// The codegen test checks that this one does contain a call, so the scan can see calls at all
+extern "C" bool static_equivalence_erased(const system_code &a, const generic_code &b)
+{
+  return a == b;
+}
+
+template <class T> static bool erased_equivalent(const T &a, const generic_code &b)
+{
+  return system_code(a).equivalent(b);
+}
+
+int main()
+{
+  int retcode = 0;
+
+  // The typed comparisons must agree with the virtual ones for every value
+  for(int n = -2; n < 200; n++)
+  {
+    const posix_code p(n);
+    const generic_code g(static_cast<errc>(n));
+    for(int m = -2; m < 200; m += 7)
+    {
+      const generic_code h(static_cast<errc>(m));
+      CHECK(static_equivalence_posix_generic(p, h) == erased_equivalent(p, h));
+      CHECK(static_equivalence_generic_posix(h, p) == erased_equivalent(p, h));
+      CHECK((g == h) == erased_equivalent(g, h));
+    }
+  }
+  for(int n = 0; n < 700; n++)
+  {
+    const http_status_code c(n);
+    for(int m = -2; m < 200; m++)
+    {
+      const generic_code h(static_cast<errc>(m));
+      CHECK(static_equivalence_http_generic(c, h) == erased_equivalent(c, h));
+    }
+  }
+#ifndef _WIN32
+  for(int n = -20; n < 20; n++)
+  {
+    const getaddrinfo_code c(n);
+    for(int m = -2; m < 200; m++)
+    {
+      const generic_code h(static_cast<errc>(m));
+      CHECK((c == h) == erased_equivalent(c, h));
+      CHECK((h != c) == !erased_equivalent(c, h));
+    }
+  }
+#endif
+  {
+    // Every code in the mapping tables, and some which are not
+    std::vector<remote_nt_code> nt{remote_nt_code(0), remote_nt_code(static_cast<int32_t>(0xC0000001))};
+    std::vector<remote_win32_code> win32{remote_win32_code(0), remote_win32_code(0xffff)};
+    std::vector<remote_com_code> com{remote_com_code(0), remote_com_code(static_cast<int32_t>(0x80004005))};
+    for(const auto &i : detail::nt_code_to_win32_code_table)
+    {
+      nt.emplace_back(static_cast<int32_t>(i.from));
+      com.emplace_back(static_cast<int32_t>(i.from | 0x10000000U));
+    }
+    for(const auto &i : detail::win32_code_to_generic_code_table)
+    {
+      win32.emplace_back(i.from);
+      com.emplace_back(static_cast<int32_t>(0x80070000U | i.from));
+    }
+    for(int m = -2; m < 200; m++)
+    {
+      const generic_code h(static_cast<errc>(m));
+      for(const auto &c : nt)
+      {
+        CHECK(static_equivalence_remote_nt_generic(c, h) == erased_equivalent(c, h));
+      }
+      for(const auto &c : win32)
+      {
+        CHECK((c == h) == erased_equivalent(c, h));
+      }
+      for(const auto &c : com)
+      {
+        CHECK((h == c) == erased_equivalent(c, h));
+      }
+    }
+    for(const auto &a : nt)
+    {
+      for(const auto &b : win32)
+      {
+        CHECK(static_equivalence_remote_nt_win32(a, b) == system_code(a).equivalent(system_code(b)));
+        CHECK((b != a) == !system_code(b).equivalent(system_code(a)));
+      }
+    }
+    for(size_t n = 0; n < nt.size(); n += 7)
+    {
+      for(size_t m = 0; m < nt.size(); m += 5)
+      {
+        CHECK((nt[n] == nt[m]) == system_code(nt[n]).equivalent(system_code(nt[m])));
+      }
+    }
+    for(size_t n = 0; n < com.size(); n += 7)
+    {
+      for(size_t m = 0; m < com.size(); m += 5)
+      {
+        CHECK((com[n] == com[m]) == system_code(com[n]).equivalent(system_code(com[m])));
+      }
+    }
+    for(const auto &a : win32)
+    {
+      for(const auto &b : win32)
+      {
+        CHECK((a == b) == system_code(a).equivalent(system_code(b)));
+      }
+    }
+  }
+  // Empty codes are only equivalent to other empty codes
+  CHECK(posix_code() == generic_code());
+  CHECK(posix_code() != generic_code(errc::success));
+  CHECK(http_status_code(200) != generic_code());
+  CHECK(static_equivalence_erased(system_code(posix_code(EINVAL)), generic_code(errc::invalid_argument)));
+  CHECK(!static_equivalence_erased(system_code(posix_code(EINVAL)), generic_code(errc::timed_out)));
+
+  return retcode;
+}
@@ -0,0 +1,103 @@
+/* Proposed SG14 status_code testing
+(C) 2026 Niall Douglas <http://www.nedproductions.biz/> (1 commit)
+File Created: Oct 2026
+
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License in the accompanying file
+Licence.txt or at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+
+Distributed under the Boost Software License, Version 1.0.
+(See accompanying file Licence.txt or copy at
+http://www.boost.org/LICENSE_1_0.txt)
+*/
+
+#define SYSTEM_ERROR2_ENABLE_TELEMETRY 1
+
+#include "status-code/http_status_code.hpp"
+#include "status-code/system_error2.hpp"
+
+#include <cstdio>
+#include <thread>
+
+#define CHECK(expr)                                                                                                    \
+  if(!(expr))                                                                                                          \
+  {                                                                                                                    \
+    fprintf(stderr, #expr " failed at line %d\n", __LINE__);                                                           \
+    retcode = 1;                                                                                                       \
+  }
+
+using namespace SYSTEM_ERROR2_NAMESPACE;
+
+static unsigned long long count_of(const status_code_telemetry_snapshot &snapshot, const status_code_domain &domain,
+                                   long long value)
+{
+  for(const auto &i : snapshot.entries)
+  {
+    if(i.domain_id == domain.id() && i.value == value)
+    {
+      return i.count;
+    }
+  }
+  return 0;
+}
+
+int main()
+{
+  int retcode = 0;
+
+  const auto before = status_code_telemetry_take_snapshot();
+  CHECK(count_of(before, generic_code_domain, static_cast<long long>(errc::timed_out)) == 0);
+
+  // Only failures erased from typed codes are counted
+  for(int n = 0; n < 10; n++)
+  {
+    system_code a(generic_code(errc::timed_out));
+    system_code b(http_status_code(503));
+    system_code c(generic_code(errc::success));
+    system_code d(http_status_code(200));
+    error e(generic_code(errc::timed_out));
+    (void) a.clone();
+  }
+  // Counts from threads are aggregated, including those of threads which have exited
+  std::thread([] {
+    for(int n = 0; n < 5; n++)
+    {
+      system_code a(generic_code(errc::timed_out));
+    }
+  }).join();
+  generic_code typed(errc::timed_out);
+  (void) typed;
+
+  const auto after = status_code_telemetry_take_snapshot();
+  CHECK(count_of(after, generic_code_domain, static_cast<long long>(errc::timed_out)) == 25);
+  CHECK(count_of(after, http_status_code_domain, 503) == 10);
+  CHECK(count_of(after, generic_code_domain, 0) == 0);
+  CHECK(count_of(after, http_status_code_domain, 200) == 0);
+  CHECK(after.dropped == 0);
+  for(size_t n = 1; n < after.entries.size(); n++)
+  {
+    const auto &a = after.entries[n - 1], &b = after.entries[n];
+    CHECK(a.domain_id < b.domain_id || (a.domain_id == b.domain_id && a.value < b.value));
+  }
+
+  auto rates = status_code_telemetry_rates(before, after);
+  CHECK(rates.size() == 2);
+  for(const auto &i : rates)
+  {
+    CHECK(i.count > 0);
+  }
+  CHECK(status_code_telemetry_rates(after, after).empty());
+
+  return retcode;
+}
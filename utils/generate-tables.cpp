@@ -195,9 +195,10 @@ int main()
           }
         }
         if(win32code < 0xffff)
-          nt_win32 << "case 0x" << std::hex << (unsigned) code << ": return 0x" << win32code << ";\n";
+          nt_win32 << "SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x" << std::hex << (unsigned) code << ", 0x" << win32code
+                   << ")\n";
         if(errc[0] != '0')
-          nt_generic << "case 0x" << std::hex << (unsigned) code << ": return " << errc << ";\n";
+          nt_generic << "SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x" << std::hex << (unsigned) code << ", " << errc << ")\n";
       }
     }
   }
@@ -217,10 +218,10 @@ int main()
       }
     }
     if(errc[0] != '0')
-      win32_generic << "case 0x" << std::hex << win32code << ": return " << errc << ";\n";
+      win32_generic << "SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x" << std::hex << win32code << ", " << errc << ")\n";
     /* Omissions from the C++ 11 STL mapping */
     else if(win32code == 0x57 /*ERROR_INVALID_PARAMETER*/)
-      win32_generic << "case 0x" << std::hex << win32code << ": return EINVAL;\n";
+      win32_generic << "SYSTEM_ERROR2_WINDOWS_CODE_MAPPING(0x" << std::hex << win32code << ", EINVAL)\n";
   }
 }
 